@@ -110,6 +110,7 @@
 #include <86box/acpi.h>
 #include <86box/nv/vid_nv_rivatimer.h>
 #include <86box/vfio.h>
+#include <minitrace/minitrace.h>
 
 // Disable c99-designator to avoid the warnings about int ng
 #ifdef __clang__
@@ -338,6 +339,8 @@ extern int CPUID;
 extern int output;
 int        atfullspeed;
 
+extern bool fast_forward; /* run unpaced; lives in the platform main loop */
+
 extern double exp_pow_table[0x800];
 
 char  exe_path[2048]; /* path (dir) of executable */
@@ -725,6 +728,7 @@ pc_show_usage(void)
             "-T or --testmode\t\t- test mode: execute the test mode entry\n"
             "\t\t\t\t   point on init/hard reset\n"
 #endif
+            "-U or --fastforward\t\t- start with fast forward engaged\n"
             "-V or --vmname name\t\t- overrides the name of the running VM\n"
 #ifdef _WIN32
             "-W or --nohook\t\t- disables keyboard hook\n"
@@ -932,6 +936,8 @@ usage:
 #endif
         } else if (!strcasecmp(argv[c], "--testmode") || !strcasecmp(argv[c], "-T")) {
             test_mode = 1;
+        } else if (!strcasecmp(argv[c], "--fastforward") || !strcasecmp(argv[c], "-U")) {
+            fast_forward = true;
         } else if (!strcasecmp(argv[c], "--noconfirm") || !strcasecmp(argv[c], "-N")) {
             confirm_exit_cmdl = 0;
         } else if (!strcasecmp(argv[c], "--missing") || !strcasecmp(argv[c], "-M")) {
@@ -1943,6 +1949,14 @@ pc_close(UNUSED(thread_t *ptr))
 
     video_close();
 
+#ifdef USE_INSTRUMENT
+    /* The priv registry goes away with the devices, dump first. */
+    if (instru_enabled) {
+        device_time_dump();
+        pic_stats_dump();
+    }
+#endif
+
     device_close_all();
 
     scsi_device_close_all();
@@ -1955,6 +1969,8 @@ pc_close(UNUSED(thread_t *ptr))
 
     sound_cd_thread_end();
 
+    sound_out_thread_end();
+
     cdrom_close();
 
     rdisk_close();
@@ -2003,7 +2019,9 @@ pc_run(void)
 
     /* Run a block of code. */
     startblit();
+    MTR_BEGIN("cpu", "cpu_exec");
     cpu_exec((int32_t) cpu_s->rspeed / (force_10ms ? 100 : 1000));
+    MTR_END("cpu", "cpu_exec");
     ack_pause();
 #ifdef USE_GDBSTUB /* avoid a KBC FIFO overflow when CPU emulation is stalled */
     if (gdbstub_step == GDBSTUB_EXEC) {
@@ -2214,8 +2232,10 @@ do_pause(int p)
         do_pause_ack = p;
     dopause = !!p;
     if ((p == 1) && !old_p) {
+        /* The emulator thread acknowledges at its next slice boundary;
+           sleep instead of burning the UI thread's core while waiting. */
         while (!ATOMIC_LOAD(pause_ack))
-            ;
+            plat_delay_ms(1);
     }
     ATOMIC_STORE(pause_ack, 0);
 }
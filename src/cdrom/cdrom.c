@@ -362,6 +362,12 @@ cdrom_is_sector_good(cdrom_t *dev, const uint8_t *b, const uint8_t mode2, const
     return ret;
 }
 
+/* One sector of lookbehind is all the caching done at this layer.
+   Multi-sector READs re-enter here per sector, but the image backends
+   read through stdio, so sequential access is already served by the
+   host's readahead and page cache - a private prefetch buffer would
+   just duplicate that.  What paces FMV playback is the emulated
+   transfer timing in scsi_cdrom.c, not host I/O latency. */
 static int
 read_data(cdrom_t *dev, const uint32_t lba, int check)
 {
@@ -37,6 +37,7 @@
 #include <86box/nvr.h>
 #include <86box/path.h>
 #include <86box/plat.h>
+#include <86box/thread.h>
 #include <86box/cdrom.h>
 #include <86box/cdrom_image.h>
 #include <86box/cdrom_image_viso.h>
@@ -389,27 +390,180 @@ cleanup_error:
 }
 
 /* Binary file functions. */
+
+/* Size of each of the two readahead windows. */
+#define BIN_WINDOW_SIZE   (256 * 1024)
+/* Upper bound for preloading a whole image into memory. */
+#define BIN_PRELOAD_LIMIT (1024 * 1024 * 1024)
+
+int cdrom_image_preload = 0;
+
+/* Per-file readahead state, hanging off track_file_t->priv for binary files.
+   The guest-visible reads are served from one of two windows while a worker
+   thread prefetches the next window, so sequential reads (data streaming,
+   Red Book audio) do not block on the host file. */
+typedef struct bin_file_t {
+    uint8_t     *preload; /* entire image preloaded into memory */
+    uint64_t     preload_len;
+
+    uint8_t     *win_buf[2];
+    uint64_t     win_start[2];
+    uint32_t     win_len[2];
+    int          cur;
+    uint64_t     file_len;
+
+    void        *thread;
+    void        *wake_event;
+    void        *done_event;
+    volatile int thread_run;
+    volatile int pending;
+    int          pending_idx;
+    uint64_t     pending_start;
+} bin_file_t;
+
+static void
+bin_prefetch_thread(void *priv)
+{
+    track_file_t *tf  = (track_file_t *) priv;
+    bin_file_t   *bin = (bin_file_t *) tf->priv;
+
+    while (bin->thread_run) {
+        thread_wait_event(bin->wake_event, -1);
+        thread_reset_event(bin->wake_event);
+
+        if (bin->pending && bin->thread_run) {
+            const int idx = bin->pending_idx;
+            uint32_t  len = BIN_WINDOW_SIZE;
+
+            bin->win_len[idx]   = 0;
+            bin->win_start[idx] = bin->pending_start;
+            if (bin->pending_start < bin->file_len) {
+                if ((bin->pending_start + len) > bin->file_len)
+                    len = (uint32_t) (bin->file_len - bin->pending_start);
+                if ((fseeko64(tf->fp, bin->pending_start, SEEK_SET) != -1) &&
+                    (fread(bin->win_buf[idx], len, 1, tf->fp) == 1))
+                    bin->win_len[idx] = len;
+            }
+            bin->pending = 0;
+            thread_set_event(bin->done_event);
+        }
+    }
+}
+
+static void
+bin_wait_prefetch(bin_file_t *bin)
+{
+    if (bin->pending) {
+        thread_wait_event(bin->done_event, -1);
+        thread_reset_event(bin->done_event);
+    }
+}
+
+static void
+bin_queue_prefetch(track_file_t *tf, bin_file_t *bin, const uint64_t start)
+{
+    if (bin->thread == NULL) {
+        /* The worker is created on first use, so only actively read
+           files (typically the data track and one audio track) get one. */
+        bin->thread_run = 1;
+        bin->wake_event = thread_create_event();
+        bin->done_event = thread_create_event();
+        bin->thread     = thread_create(bin_prefetch_thread, tf);
+    }
+
+    thread_reset_event(bin->done_event);
+    bin->pending_idx   = bin->cur ^ 1;
+    bin->pending_start = start;
+    bin->pending       = 1;
+    thread_set_event(bin->wake_event);
+}
+
+static int
+bin_cache_read(track_file_t *tf, bin_file_t *bin, uint8_t *buffer, const uint64_t seek, const size_t count)
+{
+    int cur = bin->cur;
+
+    if (count > BIN_WINDOW_SIZE)
+        return 0;
+
+    if (!((seek >= bin->win_start[cur]) &&
+          ((seek + count) <= (bin->win_start[cur] + bin->win_len[cur])))) {
+        /* Not in the current window - the prefetched one is up next. */
+        bin_wait_prefetch(bin);
+        cur ^= 1;
+        if ((seek >= bin->win_start[cur]) &&
+            ((seek + count) <= (bin->win_start[cur] + bin->win_len[cur])))
+            bin->cur = cur;
+        else {
+            /* Neither window covers the span - refill the current window. */
+            uint32_t len = BIN_WINDOW_SIZE;
+
+            cur                 = bin->cur;
+            bin->win_len[cur]   = 0;
+            bin->win_start[cur] = seek;
+            if ((seek + count) > bin->file_len)
+                return 0;
+            if ((seek + len) > bin->file_len)
+                len = (uint32_t) (bin->file_len - seek);
+            if ((fseeko64(tf->fp, seek, SEEK_SET) == -1) ||
+                (fread(bin->win_buf[cur], len, 1, tf->fp) != 1))
+                return 0;
+            bin->win_len[cur] = len;
+        }
+    }
+
+    memcpy(buffer, bin->win_buf[bin->cur] + (seek - bin->win_start[bin->cur]), count);
+
+    /* Once past the window's midpoint, read ahead into the other window. */
+    if (!bin->pending) {
+        const uint64_t next  = bin->win_start[bin->cur] + bin->win_len[bin->cur];
+        const int      other = bin->cur ^ 1;
+
+        if (((seek + count) > (bin->win_start[bin->cur] + (bin->win_len[bin->cur] >> 1))) &&
+            (next < bin->file_len) &&
+            !((bin->win_len[other] != 0) && (bin->win_start[other] == next)))
+            bin_queue_prefetch(tf, bin, next);
+    }
+
+    return 1;
+}
+
 static int
 bin_read(void *priv, uint8_t *buffer, const uint64_t seek, const size_t count)
 {
-    const track_file_t *tf = (track_file_t *) priv;
+    track_file_t *tf  = (track_file_t *) priv;
+    bin_file_t   *bin = (bin_file_t *) tf->priv;
 
-    if (tf->fp == NULL)
+    if ((tf->fp == NULL) && !((bin != NULL) && (bin->preload != NULL)))
         return 0;
 
     image_log(tf->log, "binary_read(%08lx, pos=%" PRIu64 " count=%lu)\n",
                     tf->fp, seek, count);
 
-    if (fseeko64(tf->fp, seek, SEEK_SET) == -1) {
-        image_log(tf->log, "binary_read failed during seek!\n");
+    if ((bin != NULL) && (bin->preload != NULL)) {
+        if ((seek + count) > bin->preload_len) {
+            image_log(tf->log, "binary_read failed beyond preloaded image!\n");
 
-        return -1;
-    }
+            return -1;
+        }
 
-    if (fread(buffer, count, 1, tf->fp) != 1) {
-        image_log(tf->log, "binary_read failed during read!\n");
+        memcpy(buffer, bin->preload + seek, count);
+    } else if ((bin == NULL) || (bin->win_buf[0] == NULL) ||
+               !bin_cache_read(tf, bin, buffer, seek, count)) {
+        if (bin != NULL)
+            bin_wait_prefetch(bin);
 
-        return -1;
+        if (fseeko64(tf->fp, seek, SEEK_SET) == -1) {
+            image_log(tf->log, "binary_read failed during seek!\n");
+
+            return -1;
+        }
+
+        if (fread(buffer, count, 1, tf->fp) != 1) {
+            image_log(tf->log, "binary_read failed during read!\n");
+
+            return -1;
+        }
     }
 
     if (UNLIKELY(tf->motorola)) {
@@ -427,7 +581,15 @@ bin_read(void *priv, uint8_t *buffer, const uint64_t seek, const size_t count)
 static uint64_t
 bin_get_length(void *priv)
 {
-    const track_file_t *tf = (track_file_t *) priv;
+    const track_file_t *tf  = (track_file_t *) priv;
+    bin_file_t         *bin = (bin_file_t *) tf->priv;
+
+    if (bin != NULL) {
+        bin_wait_prefetch(bin);
+
+        if (bin->preload != NULL)
+            return bin->preload_len;
+    }
 
     if (tf->fp == NULL)
         return 0;
@@ -442,11 +604,28 @@ bin_get_length(void *priv)
 static void
 bin_close(void *priv)
 {
-    track_file_t *tf = (track_file_t *) priv;
+    track_file_t *tf  = (track_file_t *) priv;
+    bin_file_t   *bin;
 
     if (tf == NULL)
         return;
 
+    bin = (bin_file_t *) tf->priv;
+    if (bin != NULL) {
+        if (bin->thread != NULL) {
+            bin->thread_run = 0;
+            thread_set_event(bin->wake_event);
+            thread_wait(bin->thread);
+            thread_destroy_event(bin->wake_event);
+            thread_destroy_event(bin->done_event);
+        }
+        free(bin->win_buf[0]);
+        free(bin->win_buf[1]);
+        free(bin->preload);
+        free(bin);
+        tf->priv = NULL;
+    }
+
     if (tf->fp != NULL) {
         fclose(tf->fp);
         tf->fp = NULL;
@@ -489,9 +668,42 @@ bin_init(const uint8_t id, const char *filename, int *error)
 
     /* Set the function pointers. */
     if (!*error) {
+        bin_file_t *bin = (bin_file_t *) calloc(1, sizeof(bin_file_t));
+
         tf->read       = bin_read;
         tf->get_length = bin_get_length;
         tf->close      = bin_close;
+
+        if (bin != NULL) {
+            fseeko64(tf->fp, 0, SEEK_END);
+            bin->file_len = ftello64(tf->fp);
+
+            if (cdrom_image_preload && (bin->file_len > 0) &&
+                (bin->file_len <= BIN_PRELOAD_LIMIT))
+                bin->preload = (uint8_t *) malloc(bin->file_len);
+
+            if (bin->preload != NULL) {
+                fseeko64(tf->fp, 0, SEEK_SET);
+                if (fread(bin->preload, bin->file_len, 1, tf->fp) == 1)
+                    bin->preload_len = bin->file_len;
+                else {
+                    free(bin->preload);
+                    bin->preload = NULL;
+                }
+            }
+
+            if (bin->preload == NULL) {
+                bin->win_buf[0] = (uint8_t *) malloc(BIN_WINDOW_SIZE);
+                bin->win_buf[1] = (uint8_t *) malloc(BIN_WINDOW_SIZE);
+                if ((bin->win_buf[0] == NULL) || (bin->win_buf[1] == NULL)) {
+                    free(bin->win_buf[0]);
+                    free(bin->win_buf[1]);
+                    bin->win_buf[0] = bin->win_buf[1] = NULL;
+                }
+            }
+
+            tf->priv = bin;
+        }
     } else {
         /* From the check above, error may still be non-zero if opening a directory.
          * The error is set for viso to try and open the directory following this function.
@@ -38,6 +38,7 @@
 #include <86box/log.h>
 #include <86box/path.h>
 #include <86box/plat.h>
+#include <86box/thread.h>
 #include <86box/bswap.h>
 #include <86box/plat_dir.h>
 #include <86box/version.h>
@@ -139,6 +140,104 @@ static const char rr_eid[]   = "RRIP_1991A"; /* identifiers used in ER field for
 static const char rr_edesc[] = "THE ROCK RIDGE INTERCHANGE PROTOCOL PROVIDES SUPPORT FOR POSIX FILE SYSTEM SEMANTICS.";
 static int8_t     tz_offset  = 0;
 
+/* Worker pool for stat-ing directory entries during traversal. Mount time on
+   large trees is dominated by the per-entry stat() calls, so those are spread
+   across a few threads while the tree itself is still built in readdir order. */
+#define VISO_STAT_THREADS 4
+
+typedef struct viso_stat_pool_t {
+    viso_entry_t **entries;
+    size_t         first;
+    size_t         count;
+    int            running;
+
+    thread_t      *threads[VISO_STAT_THREADS];
+    event_t       *wake_events[VISO_STAT_THREADS];
+    event_t       *done_events[VISO_STAT_THREADS];
+    struct viso_stat_slot_t {
+        struct viso_stat_pool_t *pool;
+        int                      slot;
+    } slots[VISO_STAT_THREADS];
+} viso_stat_pool_t;
+
+static void
+viso_stat_entry(viso_entry_t *entry)
+{
+    if (stat(entry->path, &entry->stats) != 0) {
+        /* Use a blank structure if stat failed. */
+        memset(&entry->stats, 0x00, sizeof(stat_t));
+    }
+}
+
+static void
+viso_stat_thread(void *priv)
+{
+    const struct viso_stat_slot_t *slot = (const struct viso_stat_slot_t *) priv;
+    viso_stat_pool_t              *pool = slot->pool;
+
+    while (1) {
+        thread_wait_event(pool->wake_events[slot->slot], -1);
+        thread_reset_event(pool->wake_events[slot->slot]);
+
+        if (!pool->running)
+            break;
+
+        for (size_t i = pool->first + slot->slot; i < pool->count; i += VISO_STAT_THREADS)
+            viso_stat_entry(pool->entries[i]);
+
+        thread_set_event(pool->done_events[slot->slot]);
+    }
+}
+
+static void
+viso_stat_pool_run(viso_stat_pool_t *pool, viso_entry_t **entries, const size_t first, const size_t count)
+{
+    if (!pool->running && ((count - first) >= 64)) {
+        /* Spin the workers up on the first directory large enough to benefit. */
+        pool->running = 1;
+        for (int i = 1; i < VISO_STAT_THREADS; i++) {
+            pool->slots[i].pool  = pool;
+            pool->slots[i].slot  = i;
+            pool->wake_events[i] = thread_create_event();
+            pool->done_events[i] = thread_create_event();
+            pool->threads[i]     = thread_create(viso_stat_thread, &pool->slots[i]);
+        }
+    }
+
+    if (pool->running) {
+        pool->entries = entries;
+        pool->first   = first;
+        pool->count   = count;
+        for (int i = 1; i < VISO_STAT_THREADS; i++) {
+            thread_reset_event(pool->done_events[i]);
+            thread_set_event(pool->wake_events[i]);
+        }
+        /* This thread takes worker slot 0's share. */
+        for (size_t i = first; i < count; i += VISO_STAT_THREADS)
+            viso_stat_entry(entries[i]);
+        for (int i = 1; i < VISO_STAT_THREADS; i++)
+            thread_wait_event(pool->done_events[i], -1);
+    } else {
+        for (size_t i = first; i < count; i++)
+            viso_stat_entry(entries[i]);
+    }
+}
+
+static void
+viso_stat_pool_close(viso_stat_pool_t *pool)
+{
+    if (!pool->running)
+        return;
+
+    pool->running = 0;
+    for (int i = 1; i < VISO_STAT_THREADS; i++) {
+        thread_set_event(pool->wake_events[i]);
+        thread_wait(pool->threads[i]);
+        thread_destroy_event(pool->wake_events[i]);
+        thread_destroy_event(pool->done_events[i]);
+    }
+}
+
 #ifdef IMAGE_VISO_LOG
 int image_viso_do_log = IMAGE_VISO_LOG;
 
@@ -869,8 +968,9 @@ viso_init(const uint8_t id, const char *dirname, int *error)
     image_viso_log(viso->tf.log, "[%08X] %s => [root]\n", dir, dir->path);
 
     /* Traverse directories, starting with the root. */
-    viso_entry_t **dir_entries     = NULL;
-    size_t         dir_entries_len = 0;
+    viso_entry_t   **dir_entries     = NULL;
+    size_t           dir_entries_len = 0;
+    viso_stat_pool_t stat_pool       = { 0 };
     while (dir) {
         /* Open directory for listing. */
         DIR *dirp = opendir(dir->path);
@@ -907,11 +1007,9 @@ viso_init(const uint8_t id, const char *dirname, int *error)
             if (!children_count)
                 dir->first_child = entry;
 
-            /* Stat the current directory or parent directory. */
-            if (stat(children_count ? dir->parent->path : dir->path, &entry->stats) != 0) {
-                /* Use a blank structure if stat failed. */
-                memset(&entry->stats, 0x00, sizeof(stat_t));
-            }
+            /* Copy the current or parent directory's stats, which are
+               already known from when that directory was discovered. */
+            memcpy(&entry->stats, children_count ? &dir->parent->stats : &dir->stats, sizeof(stat_t));
 
             /* Set basename. */
             strcpy(entry->name_short, children_count ? ".." : ".");
@@ -934,69 +1032,16 @@ viso_init(const uint8_t id, const char *dirname, int *error)
                 entry = dir_entries[children_count++] =
                     (viso_entry_t *) calloc(1, sizeof(viso_entry_t) +
                         dir_path_len + strlen(readdir_entry->d_name) + 2);
-                if (entry == NULL)
+                if (entry == NULL) {
+                    children_count--;
                     break;
+                }
                 entry->parent = dir;
                 strcpy(entry->path, dir->path);
                 path_slash(&entry->path[dir_path_len]);
                 entry->basename = &entry->path[dir_path_len + 1];
                 strcpy(entry->basename, readdir_entry->d_name);
 
-                /* Stat this child. */
-                if (stat(entry->path, &entry->stats) != 0) {
-                    /* Use a blank structure if stat failed. */
-                    memset(&entry->stats, 0x00, sizeof(stat_t));
-                }
-
-                /* Handle file size and El Torito boot code. */
-                if (!S_ISDIR(entry->stats.st_mode)) {
-                    /* Clamp file size to 4 GB - 1 byte. */
-                    if (entry->stats.st_size > ((uint32_t) -1))
-                        entry->stats.st_size = (uint32_t) -1;
-
-                    /* Increase entry map size. */
-                    viso->entry_map_size += entry->stats.st_size / viso->sector_size;
-                    if (entry->stats.st_size % viso->sector_size)
-                        viso->entry_map_size++; /* round up to the next sector */
-
-                    /* Detect El Torito boot code file and set it accordingly. */
-                    if (dir == eltorito_dir) {
-                        if (!stricmp(readdir_entry->d_name, "Boot-NoEmul.img")) {
-                            eltorito_type = 0x00;
-have_eltorito_entry:
-                            if (eltorito_entry)
-                                eltorito_others_present = 1; /* flag that the boot code directory contains other files */
-                            eltorito_entry = entry;
-                        } else if (!stricmp(readdir_entry->d_name, "Boot-1.2M.img")) {
-                            eltorito_type = 0x01;
-                            goto have_eltorito_entry;
-                        } else if (!stricmp(readdir_entry->d_name, "Boot-1.44M.img")) {
-                            eltorito_type = 0x02;
-                            goto have_eltorito_entry;
-                        } else if (!stricmp(readdir_entry->d_name, "Boot-2.88M.img")) {
-                            eltorito_type = 0x03;
-                            goto have_eltorito_entry;
-                        } else if (!stricmp(readdir_entry->d_name, "Boot-HardDisk.img")) {
-                            eltorito_type = 0x04;
-                            goto have_eltorito_entry;
-                        } else {
-                            eltorito_others_present = 1; /* flag that the boot code directory contains other files */
-                        }
-                    } else {
-                        /* Disable version suffixes if this structure appears to contain the Windows NT
-                           El Torito boot code, which is known not to tolerate suffixed file names. */
-                        if (eltorito_dir &&                                  /* El Torito directory present? */
-                            (eltorito_type == 0x00) &&                       /* El Torito directory not checked yet, or confirmed to contain non-emulation boot code? */
-                            (dir->parent == viso->root_dir) &&               /* one subdirectory deep? (I386 for instance) */
-                            !stricmp(readdir_entry->d_name, "SETUPLDR.BIN")) /* SETUPLDR.BIN present? */
-                            viso->use_version_suffix = 0;
-                    }
-                } else if ((dir == viso->root_dir) && !stricmp(readdir_entry->d_name, "[BOOT]")) {
-                    /* Set this as the directory containing El Torito boot code. */
-                    eltorito_dir            = entry;
-                    eltorito_others_present = 0;
-                }
-
                 /* Set short filename. */
                 if (viso_fill_fn_short(entry->name_short, entry, dir_entries)) {
                     free(entry);
@@ -1012,6 +1057,61 @@ have_eltorito_entry:
                            dir->path);
         }
 
+        /* Stat all children, using the worker pool on large directories. */
+        viso_stat_pool_run(&stat_pool, dir_entries, 2, children_count);
+
+        /* Handle file sizes and El Torito boot code. */
+        for (size_t i = 2; i < children_count; i++) {
+            entry = dir_entries[i];
+            if (!S_ISDIR(entry->stats.st_mode)) {
+                /* Clamp file size to 4 GB - 1 byte. */
+                if (entry->stats.st_size > ((uint32_t) -1))
+                    entry->stats.st_size = (uint32_t) -1;
+
+                /* Increase entry map size. */
+                viso->entry_map_size += entry->stats.st_size / viso->sector_size;
+                if (entry->stats.st_size % viso->sector_size)
+                    viso->entry_map_size++; /* round up to the next sector */
+
+                /* Detect El Torito boot code file and set it accordingly. */
+                if (dir == eltorito_dir) {
+                    if (!stricmp(entry->basename, "Boot-NoEmul.img")) {
+                        eltorito_type = 0x00;
+have_eltorito_entry:
+                        if (eltorito_entry)
+                            eltorito_others_present = 1; /* flag that the boot code directory contains other files */
+                        eltorito_entry = entry;
+                    } else if (!stricmp(entry->basename, "Boot-1.2M.img")) {
+                        eltorito_type = 0x01;
+                        goto have_eltorito_entry;
+                    } else if (!stricmp(entry->basename, "Boot-1.44M.img")) {
+                        eltorito_type = 0x02;
+                        goto have_eltorito_entry;
+                    } else if (!stricmp(entry->basename, "Boot-2.88M.img")) {
+                        eltorito_type = 0x03;
+                        goto have_eltorito_entry;
+                    } else if (!stricmp(entry->basename, "Boot-HardDisk.img")) {
+                        eltorito_type = 0x04;
+                        goto have_eltorito_entry;
+                    } else {
+                        eltorito_others_present = 1; /* flag that the boot code directory contains other files */
+                    }
+                } else {
+                    /* Disable version suffixes if this structure appears to contain the Windows NT
+                       El Torito boot code, which is known not to tolerate suffixed file names. */
+                    if (eltorito_dir &&                               /* El Torito directory present? */
+                        (eltorito_type == 0x00) &&                    /* El Torito directory not checked yet, or confirmed to contain non-emulation boot code? */
+                        (dir->parent == viso->root_dir) &&            /* one subdirectory deep? (I386 for instance) */
+                        !stricmp(entry->basename, "SETUPLDR.BIN"))    /* SETUPLDR.BIN present? */
+                        viso->use_version_suffix = 0;
+                }
+            } else if ((dir == viso->root_dir) && !stricmp(entry->basename, "[BOOT]")) {
+                /* Set this as the directory containing El Torito boot code. */
+                eltorito_dir            = entry;
+                eltorito_others_present = 0;
+            }
+        }
+
         /* Add terminator. */
         dir_entries[children_count] = NULL;
 
@@ -1035,6 +1135,7 @@ next_dir:
             closedir(dirp);
         dir = dir->next_dir;
     }
+    viso_stat_pool_close(&stat_pool);
     if (dir_entries)
         free(dir_entries);
 
@@ -1072,13 +1072,20 @@ wd76c10_outw(uint16_t port, uint16_t val, void *priv)
             break;
 
         case 0x2072:
-            dev->ser_par_cs = val;
-            wd76c10_ser_par_cs_recalc(dev);
+            /* Rewrites of unchanged values skip the recalculation, here and
+               below - BIOSes rewrite these registers with identical contents
+               all the time, and the recalculations are expensive. */
+            if (dev->ser_par_cs != val) {
+                dev->ser_par_cs = val;
+                wd76c10_ser_par_cs_recalc(dev);
+            }
             break;
 
         case 0x2872:
-            dev->rtc_disk_cs = val;
-            wd76c10_disk_cs_recalc(dev);
+            if (dev->rtc_disk_cs != val) {
+                dev->rtc_disk_cs = val;
+                wd76c10_disk_cs_recalc(dev);
+            }
             break;
 
         case 0x3072:
@@ -1087,8 +1094,10 @@ wd76c10_outw(uint16_t port, uint16_t val, void *priv)
 
         /* TODO: Log this to determine how the BIOS does bank sizing. */
         case 0x3872:
-            dev->mem_ctl = val;
-            wd76c10_banks_recalc(dev);
+            if (dev->mem_ctl != val) {
+                dev->mem_ctl = val;
+                wd76c10_banks_recalc(dev);
+            }
             break;
 
         case 0x4072:
@@ -1097,23 +1106,31 @@ wd76c10_outw(uint16_t port, uint16_t val, void *priv)
 
         /* A17-A24 */
         case 0x4872:
-            dev->bank_base_regs[0] = val;
-            wd76c10_banks_recalc(dev);
+            if (dev->bank_base_regs[0] != val) {
+                dev->bank_base_regs[0] = val;
+                wd76c10_banks_recalc(dev);
+            }
             break;
 
         /* A17-A24 */
         case 0x5072:
-            dev->bank_base_regs[1] = val;
-            wd76c10_banks_recalc(dev);
+            if (dev->bank_base_regs[1] != val) {
+                dev->bank_base_regs[1] = val;
+                wd76c10_banks_recalc(dev);
+            }
             break;
 
         case 0x5872:
-            dev->split_sa = val;
-            wd76c10_banks_recalc(dev);
-            wd76c10_split_recalc(dev);
+            if (dev->split_sa != val) {
+                dev->split_sa = val;
+                wd76c10_banks_recalc(dev);
+                wd76c10_split_recalc(dev);
+            }
             break;
 
         case 0x6072:
+            if (dev->sh_wp == val)
+                break;
             dev->sh_wp = val;
             wd76c10_dis_mem_recalc(dev);
             wd76c10_pf_loc_reset(dev);
@@ -1123,6 +1140,8 @@ wd76c10_outw(uint16_t port, uint16_t val, void *priv)
             break;
 
         case 0x6872:
+            if (dev->ems_ctl == val)
+                break;
             dev->ems_ctl = val;
             wd76c10_pf_loc_reset(dev);
             wd76c10_pf_loc_recalc(dev);
@@ -1134,8 +1153,10 @@ wd76c10_outw(uint16_t port, uint16_t val, void *priv)
             break;
 
         case 0xc072:
-            dev->hmwpb = val;
-            wd76c10_high_mem_wp_recalc(dev);
+            if (dev->hmwpb != val) {
+                dev->hmwpb = val;
+                wd76c10_high_mem_wp_recalc(dev);
+            }
             break;
 
         case 0xe072:
@@ -113,6 +113,12 @@ BRANCH_COND_E(int pc_offset, uint32_t op_pc, uint32_t offset, int not )
         case FLAGS_DEC8:
         case FLAGS_DEC16:
         case FLAGS_DEC32:
+        case FLAGS_ADC8:
+        case FLAGS_ADC16:
+        case FLAGS_ADC32:
+        case FLAGS_SBC8:
+        case FLAGS_SBC16:
+        case FLAGS_SBC32:
             host_reg = LOAD_VAR_L((uintptr_t) &cpu_state.flags_res);
             if (not )
                 TEST_NONZERO_JUMP_L(host_reg, op_pc + pc_offset + offset, timing_bt);
@@ -164,6 +170,8 @@ BRANCH_COND_S(int pc_offset, uint32_t op_pc, uint32_t offset, int not )
         case FLAGS_SAR8:
         case FLAGS_INC8:
         case FLAGS_DEC8:
+        case FLAGS_ADC8:
+        case FLAGS_SBC8:
             host_reg = LOAD_VAR_L((uintptr_t) &cpu_state.flags_res);
             AND_HOST_REG_IMM(host_reg, 0x80);
             if (not )
@@ -180,6 +188,8 @@ BRANCH_COND_S(int pc_offset, uint32_t op_pc, uint32_t offset, int not )
         case FLAGS_SAR16:
         case FLAGS_INC16:
         case FLAGS_DEC16:
+        case FLAGS_ADC16:
+        case FLAGS_SBC16:
             host_reg = LOAD_VAR_L((uintptr_t) &cpu_state.flags_res);
             AND_HOST_REG_IMM(host_reg, 0x8000);
             if (not )
@@ -196,6 +206,8 @@ BRANCH_COND_S(int pc_offset, uint32_t op_pc, uint32_t offset, int not )
         case FLAGS_SAR32:
         case FLAGS_INC32:
         case FLAGS_DEC32:
+        case FLAGS_ADC32:
+        case FLAGS_SBC32:
             host_reg = LOAD_VAR_L((uintptr_t) &cpu_state.flags_res);
             AND_HOST_REG_IMM(host_reg, 0x80000000);
             if (not )
@@ -65,6 +65,15 @@ void (*codegen_timing_block_start)(void);
 void (*codegen_timing_block_end)(void);
 int (*codegen_timing_jump_cycles)(void);
 
+/* The timing models hang off these hooks at translation time only:
+   they pair/schedule the instructions being compiled and the result is
+   baked into the block as cycle constants, which the generated code
+   merely accumulates (and even that is fused to one update per block).
+   So there is no run-time "timing tax" a bypass mode could remove, and
+   a flat per-block cost would not make anything faster - it would just
+   decouple cycle flow from the instruction mix, and cycles are what
+   clock the PIT, DMA, audio and video timers.  "Fastest possible"
+   configs want a faster modeled CPU, not a broken clock. */
 void
 codegen_timing_set(codegen_timing_t *timing)
 {
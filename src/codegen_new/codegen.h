@@ -43,6 +43,11 @@ typedef struct codeblock_t {
       fails.*/
     uint16_t parent, left, right;
 
+    /*Number of times the recompiled code has been entered. Once this crosses
+      CODEBLOCK_HOT_THRESHOLD the block is recompiled once more with the
+      larger hot-tier optimisation budgets.*/
+    uint16_t exec_count;
+
     uint8_t *data;
 
     uint64_t  page_mask, page_mask2;
@@ -54,6 +59,11 @@ typedef struct codeblock_t {
     uint16_t prev, next;
     uint16_t prev_2, next_2;
 
+    /*Block executed after this one on the last pass through the dispatcher.
+      Only a hint - the dispatcher fully re-validates the successor before
+      using it, so it needs no unlinking on invalidation.*/
+    uint16_t successor;
+
     /*First mem_block_t used by this block. Any subsequent mem_block_ts
       will be in the list starting at head_mem_block->next.*/
     struct mem_block_t *head_mem_block;
@@ -81,6 +91,18 @@ extern uint8_t *block_write_data;
 #define CODEBLOCK_IN_DIRTY_LIST 0x40
 /*Code block is not inlining immediate parameters, parameters must be fetched from memory*/
 #define CODEBLOCK_NO_IMMEDIATES 0x80
+/*Code block crossed the execution count threshold and was recompiled with the
+  hot-tier optimisation budgets*/
+#define CODEBLOCK_HOT           0x100
+
+/*Set on every dispatch into the block's recompiled code; the code-memory
+  allocator clears it while scanning for an eviction victim, giving
+  recently executed blocks a second chance (clock algorithm).*/
+#define CODEBLOCK_EXECUTED      0x200
+
+/*Number of executions of the recompiled code after which a block is
+  considered hot and recompiled through the second tier*/
+#define CODEBLOCK_HOT_THRESHOLD 512
 
 #define BLOCK_PC_INVALID        0xffffffff
 
@@ -281,8 +303,14 @@ codegen_mark_code_present(codeblock_t *block, uint32_t start_pc, int len)
                 block->page_mask2 |= ((uint64_t) 1 << (start_pc & PAGE_MASK_MASK));
         } else {
             if (!((start_pc ^ block->pc) & ~0xfff)) /*Starts in second page*/
+            {
                 block->page_mask |= ((uint64_t) 1 << ((start_pc >> PAGE_MASK_SHIFT) & PAGE_MASK_MASK));
-            else
+                /*Record the exact bytes in the page-wide byte mask as well,
+                  so codegen_check_flush() can tell data writes into a code
+                  page from actual code overwrites*/
+                if (pages[block->phys >> 12].byte_code_present_mask)
+                    pages[block->phys >> 12].byte_code_present_mask[(start_pc >> PAGE_BYTE_MASK_SHIFT) & PAGE_BYTE_MASK_OFFSET_MASK] |= ((uint64_t) 1 << (start_pc & PAGE_BYTE_MASK_MASK));
+            } else
                 block->page_mask2 |= ((uint64_t) 1 << ((start_pc >> PAGE_MASK_SHIFT) & PAGE_MASK_MASK));
         }
     } else
@@ -379,6 +407,19 @@ void codegen_set_loop_start(struct ir_data_t *ir, int first_instruction);
 
 #ifdef DEBUG_EXTRA
 extern uint32_t instr_counts[256 * 256];
+
+/*Self-profiling counters for the recompiler. codegen_stats_dump() logs a
+  report on every hard reset; the uop histogram is indexed by UOP_ number.*/
+typedef struct codegen_stats_t {
+    uint64_t blocks_compiled; /*first-tier recompilations*/
+    uint64_t blocks_promoted; /*hot-tier recompilations*/
+    uint64_t inval_dirty;     /*invalidated by guest writes to their page*/
+    uint64_t inval_evicted;   /*deleted or recycled to satisfy an allocation*/
+    uint64_t uop_counts[256]; /*histogram of compiled uops*/
+} codegen_stats_t;
+extern codegen_stats_t codegen_stats;
+
+extern void codegen_stats_dump(void);
 #endif
 
 #endif
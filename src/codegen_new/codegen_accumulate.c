@@ -8,6 +8,13 @@
 #include "codegen_accumulate.h"
 #include "codegen_ir.h"
 
+/* Cycle deltas are summed here at translation time and only materialize
+   as a single ADD on the counter when codegen_accumulate_flush() is
+   called: before branches, before instructions that fall back to the
+   interpreter (which includes I/O and string ops), and at the end of
+   the block.  Straight-line recompiled code therefore carries no
+   per-instruction counter updates; USE_ACYCS builds trade that back
+   for a sub-instruction-accurate count. */
 static struct {
     int count;
     int dest_reg;
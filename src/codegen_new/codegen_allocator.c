@@ -73,6 +73,27 @@ add_to_block_list(int code_block)
     }
 }
 
+/*Unlink a block from the eviction list and re-append it at the tail,
+  used when the eviction scan grants it a second chance.*/
+static void
+move_to_block_list_tail(mem_code_block_t* block)
+{
+    if (block == mem_code_block_tail)
+        return;
+
+    if (block->prev)
+        block->prev->next = block->next;
+    else
+        mem_code_block_head = block->next;
+    if (block->next)
+        block->next->prev = block->prev;
+
+    block->prev               = mem_code_block_tail;
+    block->next               = NULL;
+    mem_code_block_tail->next = block;
+    mem_code_block_tail       = block;
+}
+
 typedef struct mem_block_t {
     uint32_t offset; /*Offset into mem_block_alloc*/
     uint32_t next;
@@ -113,12 +134,28 @@ codegen_allocator_allocate(mem_block_t *parent, int code_block)
         if (mem_code_block_head == mem_code_block_tail) {
             fatal("Out of memory blocks!\n");
         } else {
-            mem_code_block_t* mem_code_block = mem_code_block_head;
-            while (mem_code_block) {
-                if (code_block != mem_code_block->number) {
-                    codegen_delete_block(&codeblock[mem_code_block->number]);
+            /*Clock scan from the oldest entry: a block dispatched into
+              since its last visit has CODEBLOCK_EXECUTED set, so clear
+              the bit and move it to the tail; the first block without
+              the bit is the victim. The second pass can only be reached
+              with every bit cleared and thus always finds one.*/
+            for (uint8_t pass = 0; (pass < 2) && !mem_block_free_list; pass++) {
+                mem_code_block_t* mem_code_block = mem_code_block_head;
+                while (mem_code_block) {
+                    mem_code_block_t* next = mem_code_block->next;
+                    if (code_block != mem_code_block->number) {
+                        codeblock_t* victim = &codeblock[mem_code_block->number];
+                        if (victim->flags & CODEBLOCK_EXECUTED) {
+                            victim->flags &= ~CODEBLOCK_EXECUTED;
+                            move_to_block_list_tail(mem_code_block);
+                        } else {
+                            codegen_delete_block(victim);
+                            if (mem_block_free_list)
+                                break;
+                        }
+                    }
+                    mem_code_block = next;
                 }
-                mem_code_block = mem_code_block->next;
             }
 
             if (mem_block_free_list)
@@ -33,4 +33,26 @@ typedef struct host_reg_def_t {
 extern host_reg_def_t codegen_host_reg_list[CODEGEN_HOST_REGS];
 extern host_reg_def_t codegen_host_fp_reg_list[CODEGEN_HOST_FP_REGS];
 
+extern uint16_t *codeblock_hash;
+
+/*Insert block_nr at the most-recently-used position of its codeblock hash
+  set, shifting the other ways down. If the block is already in the set it
+  is just moved to the front.*/
+static inline void
+codeblock_hash_insert(int hash, uint16_t block_nr)
+{
+    uint16_t *set  = &codeblock_hash[hash * HASH_WAYS];
+    int       slot = HASH_WAYS - 1;
+
+    for (int c = 0; c < HASH_WAYS; c++) {
+        if (set[c] == block_nr) {
+            slot = c;
+            break;
+        }
+    }
+    for (; slot > 0; slot--)
+        set[slot] = set[slot - 1];
+    set[0] = block_nr;
+}
+
 #endif
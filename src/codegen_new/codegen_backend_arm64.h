@@ -6,6 +6,9 @@
 
 #define HASH_SIZE   0x20000
 #define HASH_MASK   0x1ffff
+/*Associativity of the codeblock hash. Each set holds HASH_WAYS block
+  numbers, most recently used first.*/
+#define HASH_WAYS   4
 
 #define HASH(l)     ((l) &0x1ffff)
 
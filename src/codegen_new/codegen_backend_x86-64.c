@@ -289,10 +289,10 @@ codegen_backend_init(void)
     int          c;
 
     codeblock      = malloc(BLOCK_SIZE * sizeof(codeblock_t));
-    codeblock_hash = malloc(HASH_SIZE * sizeof(codeblock_t *));
+    codeblock_hash = malloc(HASH_SIZE * HASH_WAYS * sizeof(uint16_t));
 
     memset(codeblock, 0, BLOCK_SIZE * sizeof(codeblock_t));
-    memset(codeblock_hash, 0, HASH_SIZE * sizeof(codeblock_t *));
+    memset(codeblock_hash, 0, HASH_SIZE * HASH_WAYS * sizeof(uint16_t));
 
     for (c = 0; c < BLOCK_SIZE; c++)
         codeblock[c].pc = BLOCK_PC_INVALID;
@@ -54,7 +54,24 @@ static x86seg  *last_ea_seg;
 static int      last_ssegs;
 
 #ifdef DEBUG_EXTRA
-uint32_t instr_counts[256 * 256];
+uint32_t        instr_counts[256 * 256];
+codegen_stats_t codegen_stats;
+
+void
+codegen_stats_dump(void)
+{
+    pclog("codegen_stats: %llu blocks compiled, %llu promoted to the hot tier\n",
+          (unsigned long long) codegen_stats.blocks_compiled,
+          (unsigned long long) codegen_stats.blocks_promoted);
+    pclog("codegen_stats: invalidations: %llu by dirty page, %llu by eviction\n",
+          (unsigned long long) codegen_stats.inval_dirty,
+          (unsigned long long) codegen_stats.inval_evicted);
+    for (uint32_t c = 0; c < 256; c++) {
+        if (codegen_stats.uop_counts[c])
+            pclog("codegen_stats: uop %02x: %llu\n", c,
+                  (unsigned long long) codegen_stats.uop_counts[c]);
+    }
+}
 #endif
 
 static uint16_t block_free_list;
@@ -200,6 +217,9 @@ block_free_list_get(void)
             block->flags &= ~CODEBLOCK_IN_DIRTY_LIST;
             delete_dirty_block(block);
             block_free_list = get_block_nr(block);
+#ifdef DEBUG_EXTRA
+            codegen_stats.inval_evicted++;
+#endif
             break;
         }
         /*Free list is empty - free up a block*/
@@ -228,6 +248,7 @@ codegen_init(void)
     dirty_list_size                               = 0;
 #ifdef DEBUG_EXTRA
     memset(instr_counts, 0, sizeof(instr_counts));
+    memset(&codegen_stats, 0, sizeof(codegen_stats));
 #endif
 }
 
@@ -236,6 +257,10 @@ codegen_reset(void)
 {
     int c;
 
+#ifdef DEBUG_EXTRA
+    codegen_stats_dump();
+#endif
+
     for (c = 1; c < BLOCK_SIZE; c++) {
         codeblock_t *block = &codeblock[c];
 
@@ -247,7 +272,7 @@ codegen_reset(void)
     }
 
     memset(codeblock, 0, BLOCK_SIZE * sizeof(codeblock_t));
-    memset(codeblock_hash, 0, HASH_SIZE * sizeof(uint16_t));
+    memset(codeblock_hash, 0, HASH_SIZE * HASH_WAYS * sizeof(uint16_t));
     mem_reset_page_blocks();
 
     block_free_list = 0;
@@ -382,6 +407,9 @@ invalidate_block(codeblock_t *block)
     if (block->head_mem_block)
         codegen_allocator_free(block->head_mem_block);
     block->head_mem_block = NULL;
+#ifdef DEBUG_EXTRA
+    codegen_stats.inval_dirty++;
+#endif
 }
 
 static void
@@ -389,8 +417,11 @@ delete_block(codeblock_t *block)
 {
     uint32_t old_pc = block->pc;
 
-    if (block == &codeblock[codeblock_hash[HASH(block->phys)]])
-        codeblock_hash[HASH(block->phys)] = BLOCK_INVALID;
+    uint16_t *hash_set = &codeblock_hash[HASH(block->phys) * HASH_WAYS];
+    for (int way = 0; way < HASH_WAYS; way++) {
+        if (block == &codeblock[hash_set[way]])
+            hash_set[way] = BLOCK_INVALID;
+    }
 
 #ifndef RELEASE_BUILD
     if (block->pc == BLOCK_PC_INVALID)
@@ -412,8 +443,11 @@ delete_block(codeblock_t *block)
 static void
 delete_dirty_block(codeblock_t *block)
 {
-    if (block == &codeblock[codeblock_hash[HASH(block->phys)]])
-        codeblock_hash[HASH(block->phys)] = BLOCK_INVALID;
+    uint16_t *hash_set = &codeblock_hash[HASH(block->phys) * HASH_WAYS];
+    for (int way = 0; way < HASH_WAYS; way++) {
+        if (block == &codeblock[hash_set[way]])
+            hash_set[way] = BLOCK_INVALID;
+    }
 
 #ifndef RELEASE_BUILD
     if (block->pc == BLOCK_PC_INVALID)
@@ -443,6 +477,9 @@ codegen_delete_random_block(int required_mem_block)
 
             if (block->pc != BLOCK_PC_INVALID && (!required_mem_block || block->head_mem_block)) {
                 delete_block(block);
+#ifdef DEBUG_EXTRA
+                codegen_stats.inval_evicted++;
+#endif
                 return;
             }
         }
@@ -450,18 +487,44 @@ codegen_delete_random_block(int required_mem_block)
     }
 }
 
+/*Check whether any of the dirty bytes in the given 64-byte chunks are
+  actually covered by code. Data writes into a code page set the chunk
+  dirty mask but not the byte-level intersection, and need not evict the
+  blocks sharing the chunk.*/
+static int
+codegen_dirty_hits_code(page_t *page, uint64_t dirty_chunks)
+{
+    if (!page->byte_dirty_mask || !page->byte_code_present_mask)
+        return 1;
+
+    for (int c = 0; c < 64; c++) {
+        if ((dirty_chunks & ((uint64_t) 1 << c)) && (page->byte_dirty_mask[c] & page->byte_code_present_mask[c]))
+            return 1;
+    }
+
+    return 0;
+}
+
 void
 codegen_check_flush(page_t *page, UNUSED(uint64_t mask), UNUSED(uint32_t phys_addr))
 {
     uint16_t block_nr               = page->block;
     int      remove_from_evict_list = 0;
+    uint64_t surviving_mask         = 0;
 
     while (block_nr) {
         codeblock_t *block      = &codeblock[block_nr];
         uint16_t     next_block = block->next;
-
-        if (*block->dirty_mask & block->page_mask) {
-            invalidate_block(block);
+        uint64_t     dirty      = *block->dirty_mask & block->page_mask;
+
+        if (dirty) {
+            /*Byte-mask blocks are already byte-precise; for 64-byte
+              granularity blocks only evict when the written bytes hit code,
+              and keep the surviving chunks marked as code present.*/
+            if ((block->flags & CODEBLOCK_BYTE_MASK) || codegen_dirty_hits_code(page, dirty))
+                invalidate_block(block);
+            else
+                surviving_mask |= block->page_mask;
         }
 #ifndef RELEASE_BUILD
         if (block_nr == next_block)
@@ -488,7 +551,7 @@ codegen_check_flush(page_t *page, UNUSED(uint64_t mask), UNUSED(uint32_t phys_ad
 
     if (page->code_present_mask & page->dirty_mask)
         remove_from_evict_list = 1;
-    page->code_present_mask &= ~page->dirty_mask;
+    page->code_present_mask = (page->code_present_mask & ~page->dirty_mask) | surviving_mask;
     page->dirty_mask = 0;
 
     for (uint8_t c = 0; c < 64; c++) {
@@ -516,8 +579,8 @@ codegen_block_init(uint32_t phys_addr)
 #endif
     block_current = get_block_nr(block);
 
-    block_num                 = HASH(phys_addr);
-    codeblock_hash[block_num] = block_current;
+    block_num = HASH(phys_addr);
+    codeblock_hash_insert(block_num, block_current);
 
     block->ins         = 0;
     block->pc          = cs + cpu_state.pc;
@@ -527,9 +590,11 @@ codegen_block_init(uint32_t phys_addr)
     block->dirty_mask2 = NULL;
     block->next = block->prev = BLOCK_INVALID;
     block->next_2 = block->prev_2 = BLOCK_INVALID;
+    block->successor              = BLOCK_INVALID;
     block->page_mask = block->page_mask2 = 0;
     block->flags                         = CODEBLOCK_STATIC_TOP;
     block->status                        = cpu_cur_status;
+    block->exec_count                    = 0;
 
     recomp_page = block->phys & ~0xfff;
     codeblock_tree_add(block);
@@ -709,6 +774,15 @@ codegen_block_generate_end_mask_mark(void)
 
     p = &pages[block->phys >> 12];
     p->code_present_mask |= block->page_mask;
+    /*First-pass blocks have no per-instruction extents yet, so mark their
+      chunks as fully code-covered at byte granularity until a recompile
+      records the precise ranges.*/
+    if (p->byte_code_present_mask) {
+        for (uint32_t c = 0; c < 64; c++) {
+            if (block->page_mask & ((uint64_t) 1 << c))
+                p->byte_code_present_mask[c] = ~(uint64_t) 0;
+        }
+    }
     if ((p->dirty_mask & block->page_mask) && !page_in_evict_list(p))
         page_add_to_evict_list(p);
 
@@ -726,6 +800,12 @@ codegen_block_generate_end_mask_mark(void)
                 block->page_mask2 |= ((uint64_t) 1 << start_pc);
 
             page_2->code_present_mask |= block->page_mask2;
+            if (page_2->byte_code_present_mask) {
+                for (uint32_t c = 0; c < 64; c++) {
+                    if (block->page_mask2 & ((uint64_t) 1 << c))
+                        page_2->byte_code_present_mask[c] = ~(uint64_t) 0;
+                }
+            }
             if ((page_2->dirty_mask & block->page_mask2) && !page_in_evict_list(page_2))
                 page_add_to_evict_list(page_2);
 
@@ -767,6 +847,13 @@ codegen_block_end_recompile(codeblock_t *block)
     codegen_timing_block_end();
     codegen_accumulate(ir_data, ACCREG_cycles, -codegen_block_cycles);
 
+#ifdef DEBUG_EXTRA
+    if (block->flags & CODEBLOCK_HOT)
+        codegen_stats.blocks_promoted++;
+    else
+        codegen_stats.blocks_compiled++;
+#endif
+
     if (block->flags & CODEBLOCK_IN_DIRTY_LIST)
         block_dirty_list_remove(block);
     else
@@ -789,6 +876,25 @@ codegen_flush(void)
     return;
 }
 
+/*Record the exact bytes covered by a (64-byte granularity) block in the
+  page-wide byte mask, so codegen_check_flush() can tell data writes into a
+  code page from actual code overwrites. First page only - the second page
+  is not known while the block is being compiled.*/
+static void
+codegen_mark_bytes_present(codeblock_t *block, uint32_t start_pc, int len)
+{
+    page_t *page = &pages[block->phys >> 12];
+
+    if (!page->byte_code_present_mask)
+        return;
+
+    for (int c = 0; c < len; c++) {
+        uint32_t pc = start_pc + c;
+
+        page->byte_code_present_mask[(pc >> PAGE_BYTE_MASK_SHIFT) & PAGE_BYTE_MASK_OFFSET_MASK] |= ((uint64_t) 1 << (pc & PAGE_BYTE_MASK_MASK));
+    }
+}
+
 void
 codegen_mark_code_present_multibyte(codeblock_t *block, uint32_t start_pc, int len)
 {
@@ -830,10 +936,12 @@ codegen_mark_code_present_multibyte(codeblock_t *block, uint32_t start_pc, int l
                     block->page_mask |= ((uint64_t) 1 << start_pc_shifted);
                 for (start_pc_shifted = 0; start_pc_shifted <= end_pc_shifted; start_pc_shifted++)
                     block->page_mask2 |= ((uint64_t) 1 << start_pc_shifted);
+                codegen_mark_bytes_present(block, start_pc, 0x1000 - (start_pc & 0xfff));
             } else /*First page only*/
             {
                 for (; start_pc_shifted <= end_pc_shifted; start_pc_shifted++)
                     block->page_mask |= ((uint64_t) 1 << start_pc_shifted);
+                codegen_mark_bytes_present(block, start_pc, len);
             }
         }
     }
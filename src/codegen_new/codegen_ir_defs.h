@@ -214,6 +214,11 @@
 /*UOP_FSQRT - dest_reg = fsqrt(src_reg_a)*/
 #define UOP_FSQRT (UOP_TYPE_PARAMS_REGS | 0x89)
 
+/*The packed uops below operate on whole 64-bit MMX/3DNow! registers and
+  are emitted one per guest instruction; the backends lower each of them
+  to a single host SIMD instruction (SSE on x86-64, NEON on ARM64), so
+  keep new packed guest ops in this form rather than expanding them to
+  scalar uop sequences.*/
 /*UOP_MMX_ENTER - must be called before any MMX registers accessed*/
 #define UOP_MMX_ENTER (UOP_TYPE_PARAMS_IMM | 0x90 | UOP_TYPE_BARRIER)
 /*UOP_PADDB - (packed byte) dest_reg = src_reg_a + src_reg_b*/
@@ -38,11 +38,17 @@ LOAD_IMMEDIATE_FROM_RAM_32_unaligned(UNUSED(codeblock_t *block), ir_data_t *ir,
 #define UNROLL_MAX_REG_REFERENCES 200
 #define UNROLL_MAX_UOPS           1000
 #define UNROLL_MAX_COUNT          10
+/*Hot-tier blocks get a larger unrolling budget, as they have proven to be
+  worth the extra compilation effort and code cache space*/
+#define UNROLL_MAX_UOPS_HOT       2000
+#define UNROLL_MAX_COUNT_HOT      20
 int
 codegen_can_unroll_full(codeblock_t *block, ir_data_t *ir, UNUSED(uint32_t next_pc), uint32_t dest_addr)
 {
     int start;
     int max_unroll;
+    int max_unroll_uops  = (block->flags & CODEBLOCK_HOT) ? UNROLL_MAX_UOPS_HOT : UNROLL_MAX_UOPS;
+    int max_unroll_count = (block->flags & CODEBLOCK_HOT) ? UNROLL_MAX_COUNT_HOT : UNROLL_MAX_COUNT;
     int first_instruction;
     int TOP = -1;
 
@@ -63,11 +69,15 @@ codegen_can_unroll_full(codeblock_t *block, ir_data_t *ir, UNUSED(uint32_t next_
     if (TOP != cpu_state.TOP)
         return 0;
 
-    max_unroll = UNROLL_MAX_UOPS / ((ir->wr_pos - start) + 6);
+    max_unroll = max_unroll_uops / ((ir->wr_pos - start) + 6);
     if ((max_version_refcount != 0) && (max_unroll > (UNROLL_MAX_REG_REFERENCES / max_version_refcount)))
         max_unroll = (UNROLL_MAX_REG_REFERENCES / max_version_refcount);
-    if (max_unroll > UNROLL_MAX_COUNT)
-        max_unroll = UNROLL_MAX_COUNT;
+    if (max_unroll > max_unroll_count)
+        max_unroll = max_unroll_count;
+    /*Never unroll past the IR buffer - uop_alloc_unroll() will fatal() on
+      overflow*/
+    if (max_unroll > (1 + (UOP_NR_MAX - 64 - ir->wr_pos) / ((ir->wr_pos - start) + 1)))
+        max_unroll = 1 + (UOP_NR_MAX - 64 - ir->wr_pos) / ((ir->wr_pos - start) + 1);
     if (max_unroll <= 1)
         return 0;
 
@@ -72,6 +72,7 @@
 #include <86box/scsi.h>
 #include <86box/scsi_device.h>
 #include <86box/cdrom.h>
+#include <86box/cdrom_image.h>
 #include <86box/cdrom_interface.h>
 #include <86box/rdisk.h>
 #include <86box/mo.h>
@@ -209,6 +210,7 @@ load_general(void)
     dpi_scale = ini_section_get_int(cat, "dpi_scale", 1);
 
     enable_overscan  = !!ini_section_get_int(cat, "enable_overscan", 0);
+    svga_deferred_render = !!ini_section_get_int(cat, "svga_deferred_render", 0);
     vid_cga_contrast = !!ini_section_get_int(cat, "vid_cga_contrast", 0);
     video_grayscale  = ini_section_get_int(cat, "video_grayscale", 0);
     video_graytype   = ini_section_get_int(cat, "video_graytype", 0);
@@ -1175,6 +1177,8 @@ load_storage_controllers(void)
     if (p != NULL)
         cdrom_interface_current = cdrom_interface_get_from_internal_name(p);
 
+    cdrom_image_preload = !!ini_section_get_int(cat, "cdrom_image_preload", 0);
+
     if (machine_has_bus(machine, MACHINE_BUS_CASSETTE))
         cassette_enable = !!ini_section_get_int(cat, "cassette_enabled", 0);
     else
@@ -2496,6 +2500,11 @@ save_general(void)
     else
         ini_section_set_int(cat, "enable_overscan", enable_overscan);
 
+    if (svga_deferred_render == 0)
+        ini_section_delete_var(cat, "svga_deferred_render");
+    else
+        ini_section_set_int(cat, "svga_deferred_render", svga_deferred_render);
+
     if (vid_cga_contrast == 0)
         ini_section_delete_var(cat, "vid_cga_contrast");
     else
@@ -3244,6 +3253,11 @@ save_storage_controllers(void)
         ini_section_set_string(cat, "cdrom_interface",
                                cdrom_interface_get_internal_name(cdrom_interface_current));
 
+    if (cdrom_image_preload == 0)
+        ini_section_delete_var(cat, "cdrom_image_preload");
+    else
+        ini_section_set_int(cat, "cdrom_image_preload", cdrom_image_preload);
+
     if (cassette_enable == 0)
         ini_section_delete_var(cat, "cassette_enabled");
     else
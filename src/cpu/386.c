@@ -29,6 +29,9 @@
 #include <86box/plat_fallthrough.h>
 #include <86box/plat_unused.h>
 #include <86box/gdbstub.h>
+#ifdef USE_INSTRTRACE
+#    include <86box/instrtrace.h>
+#endif
 #ifndef OPS_286_386
 #    define OPS_286_386
 #endif
@@ -284,6 +287,9 @@ exec386_2386(int32_t cycs)
 #ifdef ENABLE_386_LOG
                 if (in_smm)
                     x386_log("[%04X:%08X] %08X\n", CS, cpu_state.pc, fetchdat);
+#endif
+#ifdef USE_INSTRTRACE
+                instrtrace_instruction(CS, cpu_state.pc, fetchdat, cpu_state.flags | (cpu_state.eflags << 16));
 #endif
                 opcode = fetchdat & 0xFF;
                 fetchdat >>= 8;
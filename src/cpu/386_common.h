@@ -443,6 +443,14 @@ get_ram_ptr(uint32_t a)
 extern int opcode_has_modrm[256];
 extern int opcode_length[256];
 
+/* Instruction fetch fast path: pccache/pccache2 cache a direct host pointer
+   to the current code page, so in the common case the interpreter pulls up
+   to four opcode bytes with a single load and no address translation.
+   opcode_length bounds the fetch so it never crosses into the next page
+   (and never faults there) unless the instruction itself does.  The opcode
+   handlers fetch and decode their own operands past these bytes, so there
+   is nothing further to predecode here; caching decoded instructions is
+   what the dynamic recompiler is for. */
 #ifdef OPS_286_386
 static __inline uint16_t
 fastreadw_fetch(uint32_t a)
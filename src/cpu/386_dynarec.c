@@ -32,6 +32,9 @@
 #include <86box/plat_fallthrough.h>
 #include <86box/plat_unused.h>
 #include <86box/gdbstub.h>
+#ifdef USE_INSTRTRACE
+#    include <86box/instrtrace.h>
+#endif
 #ifdef USE_DYNAREC
 #    include "codegen.h"
 #    ifdef USE_NEW_DYNAREC
@@ -315,6 +318,9 @@ exec386_dynarec_int(void)
 #    endif
 
         if (!cpu_state.abrt) {
+#    ifdef USE_INSTRTRACE
+            instrtrace_instruction(CS, cpu_state.pc, fetchdat, cpu_state.flags | (cpu_state.eflags << 16));
+#    endif
             opcode = fetchdat & 0xFF;
             fetchdat >>= 8;
 
@@ -387,6 +393,12 @@ block_ended:
     cpu_end_block_after_ins = 0;
 }
 
+#    ifdef USE_NEW_DYNAREC
+/*Block executed on the previous pass through the dispatcher, used to record
+  and probe successor hints for block chaining.*/
+static uint16_t chain_prev_block = BLOCK_INVALID;
+#    endif
+
 #if defined(__linux__) && !defined(__clang__) && defined(USE_NEW_DYNAREC)
 static inline void __attribute__((optimize("O2")))
 #else
@@ -396,9 +408,38 @@ exec386_dynarec_dyn(void)
 {
     uint32_t start_pc  = 0;
     uint32_t phys_addr = get_phys(cs + cpu_state.pc);
+
+#ifdef USE_INSTRTRACE
+    /* Compiled blocks execute without per-instruction hooks, so the
+       dynarec side of a trace is block-entry granular. */
+    instrtrace_block(CS, cpu_state.pc, cpu_state.flags | (cpu_state.eflags << 16));
+#endif
     int      hash      = HASH(phys_addr);
 #    ifdef USE_NEW_DYNAREC
-    codeblock_t *block = &codeblock[codeblock_hash[hash]];
+    codeblock_t *block;
+
+    /* Probe the successor recorded on the previous dispatcher pass before
+       the hash. For static branch targets this chains straight into the
+       next block and avoids the tree walk when the hash slot has been taken
+       over by a conflicting block. The hint goes through the same validity
+       checks as a hash hit below, so a stale successor just falls back. */
+    if (chain_prev_block != BLOCK_INVALID
+        && codeblock[chain_prev_block].successor != BLOCK_INVALID
+        && (codeblock[codeblock[chain_prev_block].successor].pc == cs + cpu_state.pc)
+        && (codeblock[codeblock[chain_prev_block].successor].phys == phys_addr))
+        block = &codeblock[codeblock[chain_prev_block].successor];
+    else {
+        const uint16_t *hash_set = &codeblock_hash[hash * HASH_WAYS];
+
+        block = &codeblock[hash_set[0]];
+        for (int way = 1; way < HASH_WAYS; way++) {
+            if ((codeblock[hash_set[way]].pc == cs + cpu_state.pc) && (codeblock[hash_set[way]].phys == phys_addr)) {
+                block = &codeblock[hash_set[way]];
+                codeblock_hash_insert(hash, hash_set[way]);
+                break;
+            }
+        }
+    }
 #    else
     codeblock_t *block = codeblock_hash[hash];
 #    endif
@@ -435,7 +476,7 @@ exec386_dynarec_dyn(void)
                     if (valid_block) {
                         block = new_block;
 #    ifdef USE_NEW_DYNAREC
-                        codeblock_hash[hash] = get_block_nr(block);
+                        codeblock_hash_insert(hash, get_block_nr(block));
 #    endif
                     }
                 }
@@ -513,6 +554,15 @@ exec386_dynarec_dyn(void)
     }
 
 #    ifdef USE_NEW_DYNAREC
+    if (valid_block && (block->flags & CODEBLOCK_WAS_RECOMPILED) && !(block->flags & (CODEBLOCK_HOT | CODEBLOCK_IN_DIRTY_LIST)) && ++block->exec_count >= CODEBLOCK_HOT_THRESHOLD) {
+        /* Block crossed the execution threshold - promote it to the hot tier
+           and take the recompile path below, which will regenerate it with
+           the larger optimisation budgets. Blocks on the dirty list are
+           being rewritten by the guest and are not worth promoting. */
+        block->flags |= CODEBLOCK_HOT;
+        block->flags &= ~CODEBLOCK_WAS_RECOMPILED;
+    }
+
     if (valid_block && (block->flags & CODEBLOCK_WAS_RECOMPILED))
 #    else
     if (valid_block && block->was_recompiled)
@@ -520,7 +570,16 @@ exec386_dynarec_dyn(void)
     {
         void (*code)(void) = (void *) &block->data[BLOCK_START];
 
-#    ifndef USE_NEW_DYNAREC
+#    ifdef USE_NEW_DYNAREC
+        /* Record this block as the successor of the previously executed one,
+           then remember it for the next pass. */
+        if (chain_prev_block != BLOCK_INVALID)
+            codeblock[chain_prev_block].successor = get_block_nr(block);
+        chain_prev_block = get_block_nr(block);
+
+        /* Recency mark for the code-memory allocator's eviction scan. */
+        block->flags |= CODEBLOCK_EXECUTED;
+#    else
         codeblock_hash[hash] = block;
 #    endif
         inrecomp = 1;
@@ -545,6 +604,10 @@ exec386_dynarec_dyn(void)
         cpu_block_end = 0;
         x86_was_reset = 0;
 
+#    ifdef USE_NEW_DYNAREC
+        chain_prev_block = BLOCK_INVALID;
+#    endif
+
 #    if defined(__APPLE__) && defined(__aarch64__)
         if (__builtin_available(macOS 11.0, *)) {
             pthread_jit_write_protect_np(0);
@@ -653,6 +716,10 @@ exec386_dynarec_dyn(void)
         cpu_block_end = 0;
         x86_was_reset = 0;
 
+#    ifdef USE_NEW_DYNAREC
+        chain_prev_block = BLOCK_INVALID;
+#    endif
+
         codegen_block_init(phys_addr);
 
         while (!cpu_block_end) {
@@ -938,6 +1005,9 @@ exec386(int32_t cycs)
 #ifdef ENABLE_386_LOG
                 if (in_smm)
                     x386_dynarec_log("[%04X:%08X] %08X\n", CS, cpu_state.pc, fetchdat);
+#endif
+#ifdef USE_INSTRTRACE
+                instrtrace_instruction(CS, cpu_state.pc, fetchdat, cpu_state.flags | (cpu_state.eflags << 16));
 #endif
                 opcode = fetchdat & 0xFF;
                 fetchdat >>= 8;
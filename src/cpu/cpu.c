@@ -86,6 +86,16 @@ enum {
 #endif
 
 /* Make sure this is as low as possible. */
+/* Cache-line aligned so the hot execution state (regs/tag/ea in the first
+   line, flags/pc/cycles in the second) always lands on line boundaries
+   instead of wherever the linker happens to put it, and so the int8
+   displacements the dynarec backends build with cpu_state_offset() stay
+   within the first two lines. */
+#if defined(_MSC_VER)
+__declspec(align(64))
+#else
+__attribute__((aligned(64)))
+#endif
 cpu_state_t cpu_state;
 fpu_state_t fpu_state;
 
@@ -604,6 +614,14 @@ cpu_set(void)
     x86_dynarec_opcodes_3DNOW = dynarec_ops_3DNOW;
 #endif /* USE_DYNAREC */
 
+    /* Two complete x87 implementations are selected here as whole opcode
+       tables: the host-FPU one (x87_ops_*, the fast default) and the
+       IEEE-exact softfloat3e one (x87_ops_sf_*, opted into per config or
+       forced by MACHINE_SOFTFLOAT_ONLY).  Keep the choice at this
+       granularity: a per-instruction demotion from softfloat to host
+       doubles can't honour the 80-bit default precision the accurate
+       path exists to provide, and machines that force softfloat do so
+       because host FP semantics are not good enough for them. */
     if (hasfpu) {
 #ifdef USE_DYNAREC
         if (fpu_softfloat) {
@@ -710,7 +710,16 @@ opHLT(UNUSED(uint32_t fetchdat))
     if (smi_line)
         enter_smm_check(1);
     else if (!((cpu_state.flags & I_FLAG) && pic.int_pending)) {
-        CLOCK_CYCLES_ALWAYS(100);
+        /* Halted with nothing pending: everything that could wake us
+           (device interrupts, NMI, SMI, input, network) is raised from the
+           timer queue, so burn the wait up to the next timer deadline in
+           one step instead of re-executing HLT every 100 cycles. Capped at
+           the cycles left in the current slice so pacing is unchanged. */
+        int32_t hlt_cycles = 100;
+        int64_t to_target  = (int64_t) (timer_target - (uint64_t) tsc);
+        if ((to_target > hlt_cycles) && (cycles > hlt_cycles))
+            hlt_cycles = (int32_t) MIN(to_target, (int64_t) cycles);
+        CLOCK_CYCLES_ALWAYS(hlt_cycles);
         if (!((cpu_state.flags & I_FLAG) && pic.int_pending))
             cpu_state.pc--;
     } else {
@@ -333,6 +333,58 @@
         while (CNT_REG > 0) {                                                                                     \
             uint32_t temp;                                                                                        \
                                                                                                                   \
+            /* Fast path - forward copy with source and destination pages in                                      \
+               the software TLB: copy a whole run of dwords with one host                                         \
+               memcpy. The run is capped at the page boundaries, the cycle                                        \
+               budget and the overlap distance (so forward-propagating                                            \
+               overlapped copies keep x86 semantics), and is only taken when                                      \
+               the segment limits cover it so faults go through the slow                                          \
+               path at the exact iteration. */                                                                    \
+            if (!(cpu_state.flags & D_FLAG) && !trap && (CNT_REG > 1) && !((SRC_REG | DEST_REG) & 3)) {           \
+                uint32_t fp_src  = cpu_state.ea_seg->base + SRC_REG;                                              \
+                uint32_t fp_dest = es + DEST_REG;                                                                 \
+                uint32_t fp_n    = CNT_REG;                                                                       \
+                int      fp_budget = ((cycles - cycles_end) / (is486 ? 3 : 4)) + 1;                               \
+                if ((readlookup2[fp_src >> 12] != (uintptr_t) LOOKUP_INV)                                         \
+                    && (writelookup2[fp_dest >> 12] != (uintptr_t) LOOKUP_INV)                                    \
+                    && !((fp_src | fp_dest) & 3) && ((fp_dest - fp_src) >= 4)) {                                  \
+                    if (fp_n > ((0x1000 - (fp_src & 0xfff)) >> 2))                                                \
+                        fp_n = (0x1000 - (fp_src & 0xfff)) >> 2;                                                  \
+                    if (fp_n > ((0x1000 - (fp_dest & 0xfff)) >> 2))                                               \
+                        fp_n = (0x1000 - (fp_dest & 0xfff)) >> 2;                                                 \
+                    if (fp_n > ((fp_dest - fp_src) >> 2))                                                         \
+                        fp_n = (fp_dest - fp_src) >> 2;                                                           \
+                    if (sizeof(SRC_REG) == 2) {                                                                   \
+                        if (fp_n > ((0x10000 - (uint32_t) SRC_REG) >> 2))                                         \
+                            fp_n = (0x10000 - (uint32_t) SRC_REG) >> 2;                                           \
+                        if (fp_n > ((0x10000 - (uint32_t) DEST_REG) >> 2))                                        \
+                            fp_n = (0x10000 - (uint32_t) DEST_REG) >> 2;                                          \
+                    }                                                                                             \
+                    if ((fp_budget > 0) && (fp_n > (uint32_t) fp_budget))                                         \
+                        fp_n = fp_budget;                                                                         \
+                    if ((fp_n > 1)                                                                                \
+                        && ((uint32_t) SRC_REG >= cpu_state.ea_seg->limit_low)                                    \
+                        && (((uint32_t) SRC_REG + (fp_n * 4) - 1) <= cpu_state.ea_seg->limit_high)                \
+                        && ((uint32_t) DEST_REG >= cpu_state.seg_es.limit_low)                                    \
+                        && (((uint32_t) DEST_REG + (fp_n * 4) - 1) <= cpu_state.seg_es.limit_high)                \
+                        && (!(msw & 1) || (cpu_state.eflags & VM_FLAG)                                            \
+                            || ((cpu_state.ea_seg->access & 0x80) && (cpu_state.seg_es.access & 0x80)))) {        \
+                        memcpy((void *) (writelookup2[fp_dest >> 12] + fp_dest),                                  \
+                               (void *) (readlookup2[fp_src >> 12] + fp_src), fp_n * 4);                          \
+                        SRC_REG += fp_n * 4;                                                                      \
+                        DEST_REG += fp_n * 4;                                                                     \
+                        CNT_REG -= fp_n;                                                                          \
+                        cycles -= fp_n * (is486 ? 3 : 4);                                                         \
+                        reads += fp_n;                                                                            \
+                        writes += fp_n;                                                                           \
+                        total_cycles += fp_n * (is486 ? 3 : 4);                                                   \
+                        if (cycles < cycles_end)                                                                  \
+                            break;                                                                                \
+                        continue;                                                                                 \
+                    }                                                                                             \
+                }                                                                                                 \
+            }                                                                                                     \
+                                                                                                                  \
             CHECK_READ_REP(cpu_state.ea_seg, SRC_REG, SRC_REG + 3UL);                                             \
             CHECK_WRITE_REP(&cpu_state.seg_es, DEST_REG, DEST_REG + 3UL);                                         \
             high_page = 0;                                                                                        \
@@ -446,6 +498,42 @@
         if (CNT_REG > 0)                                                                                          \
             SEG_CHECK_WRITE(&cpu_state.seg_es);                                                                   \
         while (CNT_REG > 0) {                                                                                     \
+            /* Fast path - forward fill with the destination page in the                                          \
+               software TLB: store a whole run of dwords at once. Only taken                                      \
+               when the segment limit covers the run, so faults go through                                        \
+               the slow path at the exact iteration. */                                                           \
+            if (!(cpu_state.flags & D_FLAG) && !trap && (CNT_REG > 1) && !(DEST_REG & 3)) {                       \
+                uint32_t fp_dest = es + DEST_REG;                                                                 \
+                uint32_t fp_n    = CNT_REG;                                                                       \
+                int      fp_budget = ((cycles - cycles_end) / (is486 ? 4 : 5)) + 1;                               \
+                if ((writelookup2[fp_dest >> 12] != (uintptr_t) LOOKUP_INV) && !(fp_dest & 3)) {                  \
+                    if (fp_n > ((0x1000 - (fp_dest & 0xfff)) >> 2))                                               \
+                        fp_n = (0x1000 - (fp_dest & 0xfff)) >> 2;                                                 \
+                    if (sizeof(DEST_REG) == 2) {                                                                  \
+                        if (fp_n > ((0x10000 - (uint32_t) DEST_REG) >> 2))                                        \
+                            fp_n = (0x10000 - (uint32_t) DEST_REG) >> 2;                                          \
+                    }                                                                                             \
+                    if ((fp_budget > 0) && (fp_n > (uint32_t) fp_budget))                                         \
+                        fp_n = fp_budget;                                                                         \
+                    if ((fp_n > 1)                                                                                \
+                        && ((uint32_t) DEST_REG >= cpu_state.seg_es.limit_low)                                    \
+                        && (((uint32_t) DEST_REG + (fp_n * 4) - 1) <= cpu_state.seg_es.limit_high)                \
+                        && (!(msw & 1) || (cpu_state.eflags & VM_FLAG) || (cpu_state.seg_es.access & 0x80))) {    \
+                        uint32_t *fp_p = (uint32_t *) (writelookup2[fp_dest >> 12] + fp_dest);                    \
+                        for (uint32_t fp_i = 0; fp_i < fp_n; fp_i++)                                              \
+                            fp_p[fp_i] = EAX;                                                                     \
+                        DEST_REG += fp_n * 4;                                                                     \
+                        CNT_REG -= fp_n;                                                                          \
+                        cycles -= fp_n * (is486 ? 4 : 5);                                                         \
+                        writes += fp_n;                                                                           \
+                        total_cycles += fp_n * (is486 ? 4 : 5);                                                   \
+                        if (cycles < cycles_end)                                                                  \
+                            break;                                                                                \
+                        continue;                                                                                 \
+                    }                                                                                             \
+                }                                                                                                 \
+            }                                                                                                     \
+                                                                                                                  \
             CHECK_WRITE_REP(&cpu_state.seg_es, DEST_REG, DEST_REG + 3UL);                                         \
             writememl(es, DEST_REG, EAX);                                                                         \
             if (cpu_state.abrt)                                                                                   \
@@ -82,6 +82,77 @@ device_log(const char *fmt, ...)
 #    define device_log(fmt, ...)
 #endif
 
+#ifdef USE_INSTRUMENT
+#    define DEVICE_TIME_SLOTS 512 /* power of two, larger than DEVICE_MAX */
+
+typedef struct device_time_t {
+    void    *priv;
+    uint64_t time;
+    uint64_t calls;
+} device_time_t;
+
+static device_time_t device_time[DEVICE_TIME_SLOTS];
+
+/* Charge host time to whatever was registered with the given priv
+   pointer; the owning device is resolved at dump time so the hot path
+   is just a hash probe. */
+void
+device_time_add(void *priv, uint64_t time)
+{
+    uint32_t slot = (uint32_t) (((uintptr_t) priv) >> 4) & (DEVICE_TIME_SLOTS - 1);
+
+    for (uint16_t c = 0; c < DEVICE_TIME_SLOTS; c++) {
+        if ((device_time[slot].priv == priv) || (device_time[slot].priv == NULL)) {
+            device_time[slot].priv = priv;
+            device_time[slot].time += time;
+            device_time[slot].calls++;
+            return;
+        }
+
+        slot = (slot + 1) & (DEVICE_TIME_SLOTS - 1);
+    }
+}
+
+static int
+device_time_compare(const void *a, const void *b)
+{
+    const device_time_t *da = (const device_time_t *) a;
+    const device_time_t *db = (const device_time_t *) b;
+
+    return (db->time > da->time) - (db->time < da->time);
+}
+
+/* Print the accumulated per-device host time, most expensive first.
+   Must run before device_close_all() while the priv registry is
+   still populated. */
+void
+device_time_dump(void)
+{
+    device_time_t sorted[DEVICE_TIME_SLOTS];
+
+    memcpy(sorted, device_time, sizeof(sorted));
+    qsort(sorted, DEVICE_TIME_SLOTS, sizeof(device_time_t), device_time_compare);
+
+    for (uint16_t c = 0; c < DEVICE_TIME_SLOTS; c++) {
+        const char *name = "(not a device)";
+        uint64_t    usec;
+
+        if (sorted[c].priv == NULL)
+            continue;
+
+        for (uint16_t d = 0; d < DEVICE_MAX; d++) {
+            if ((device_priv[d] == sorted[c].priv) && (devices[d] != NULL) && (devices[d]->name != NULL)) {
+                name = devices[d]->name;
+                break;
+            }
+        }
+
+        usec = timer_freq ? ((sorted[c].time * 1000000ULL) / timer_freq) : sorted[c].time;
+        printf("[instrument] %-40s %12llu us, %llu calls\n", name, usec, sorted[c].calls);
+    }
+}
+#endif
+
 /* Initialize the module for use. */
 void
 device_init(void)
@@ -719,6 +719,15 @@ kbc_at_poll_ps2(atkbc_t *dev)
     }
 }
 
+/* The two 100 us poll timers below run whether or not anything is
+   queued.  Tempting as it is to quiesce them when the controller is
+   idle, the cadence is the emulated controller's scan loop: command
+   response latency, typematic pacing and the kbd/aux scan interleave
+   are all guest-visible consequences of it, and BIOS POST code is
+   known to be picky about them.  Stopping the timers would also need
+   a re-arm from wherever input originates, and the UI thread must not
+   touch the CPU thread's timer heap.  An idle fire is a heap pop, a
+   state check and a re-arm - that is the price of the fidelity. */
 static void
 kbc_at_poll(void *priv)
 {
@@ -27,6 +27,8 @@
 #include <86box/machine.h>
 #include <86box/device.h>
 #include <86box/keyboard.h>
+
+#include <minitrace/minitrace.h>
 #include <86box/plat.h>
 
 #include "cpu.h"
@@ -279,6 +281,9 @@ keyboard_input(int down, uint16_t scan)
     if (kbd_in_reset)
         return;
 
+    /* Input-latency stage 1: host event arrives from the UI layer. */
+    MTR_INSTANT_I("input", "keyboard_input", "scan", (intptr_t) scan);
+
     /* Special case for E1 1D, translate it to 0100 - special case. */
     if ((scan >> 8) == 0xe1) {
         if ((scan & 0xff) == 0x1d)
@@ -27,6 +27,8 @@
 #include <86box/mouse.h>
 #include <86box/machine.h>
 
+#include <minitrace/minitrace.h>
+
 #define FIFO_SIZE      16
 
 #define BAT_COUNT      1000
@@ -5348,6 +5350,9 @@ add_data_kbd_84(uint16_t val)
     atkbc_dev_t *dev = SavedKbd;
     uint8_t fake_shift = 0;
     uint8_t num_lock = 0;
+
+    /* Input-latency stage 2: scan code enters the device queue. */
+    MTR_INSTANT_I("input", "kbd_queue", "val", (intptr_t) val);
     uint8_t shift_states = 0;
 
     keyboard_get_states(NULL, &num_lock, NULL, NULL);
@@ -5390,6 +5395,9 @@ add_data_kbd(uint16_t val)
     uint8_t  num_lock = 0;
     uint8_t  shift_states = 0;
 
+    /* Input-latency stage 2: scan code enters the device queue. */
+    MTR_INSTANT_I("input", "kbd_queue", "val", (intptr_t) val);
+
     if ((keyboard_mode == 0x03) && (val == 0x8c)) {
         is_special = 1;
         return;
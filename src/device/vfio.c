@@ -2423,10 +2423,12 @@ vfio_region_init(vfio_device_t *dev, struct vfio_region_info *reg, vfio_region_t
         if (j && !dev->rom_fn)
             pclog("VFIO %s: A custom ROM can be loaded with the _rom_fn directive.\n", dev->name);
     } else {
-        /* Attempt to mmap the region. */
+        /* Attempt to mmap the region. MAP_POPULATE prefaults the BAR pages
+           now, so the guest driver's first accesses don't each take a page
+           fault into the vfio-pci fault handler. */
         region->mmap_base = mmap(NULL, region->size,
                                  (region->read ? PROT_READ : 0) | (region->write ? PROT_WRITE : 0),
-                                 MAP_SHARED, region->fd, region->offset);
+                                 MAP_SHARED | MAP_POPULATE, region->fd, region->offset);
         if (region->mmap_base == ((void *) -1)) /* mmap failed */
             region->mmap_base = NULL;
     }
@@ -35,6 +35,7 @@
 #include <86box/pci.h>
 #include <86box/rom.h>
 #include <86box/timer.h>
+#include <86box/thread.h>
 #include <86box/device.h>
 #include <86box/scsi_device.h>
 #include <86box/isapnp.h>
@@ -135,8 +136,20 @@ typedef struct ide_board_t {
 
     ide_t     *ide[2];
     ide_bm_t  *bm;
+
+    /* Host-side read thread, so image reads overlap with guest execution. */
+    thread_t  *read_thread;
+    event_t   *wake_read_thread;
+    int        read_thread_run;
 } ide_board_t;
 
+/* States of the per-drive host read prefetch. */
+enum {
+    PREFETCH_IDLE = 0,
+    PREFETCH_QUEUED,
+    PREFETCH_DONE
+};
+
 typedef struct mcide_t {
     uint8_t    pos_regs[8];
     uint32_t   bios_addr;
@@ -995,6 +1008,81 @@ ide_set_callback(ide_t *ide, double callback)
         timer_on_auto(&ide->timer, callback);
 }
 
+/* The per-board host read thread: while the emulated drive sits in its seek/transfer
+   delay, pull the sectors from the image on the host so they are already resident in
+   sector_buffer when the delay timer fires. The result is only published if the
+   command has not been superseded (reset or new command) in the meantime. */
+static void
+ide_read_thread(void *priv)
+{
+    ide_board_t *dev = (ide_board_t *) priv;
+    int          busy;
+
+    while (dev->read_thread_run) {
+        thread_wait_event(dev->wake_read_thread, -1);
+        thread_reset_event(dev->wake_read_thread);
+
+        do {
+            busy = 0;
+
+            for (uint8_t d = 0; d < 2; d++) {
+                ide_t *ide = dev->ide[d];
+
+                if ((ide != NULL) && (ide->prefetch_state == PREFETCH_QUEUED)) {
+                    const int      seq = ide->prefetch_seq;
+                    const uint32_t sector = ide->prefetch_sector;
+                    const uint32_t count = ide->prefetch_count;
+                    const int      ret = hdd_image_read(ide->hdd_num, sector, count,
+                                                        ide->sector_buffer);
+
+                    if (ide->prefetch_seq == seq) {
+                        ide->prefetch_ret      = ret;
+                        ide->prefetch_done_seq = seq;
+                        ide->prefetch_state    = PREFETCH_DONE;
+                    }
+
+                    busy = 1;
+                }
+            }
+        } while (busy && dev->read_thread_run);
+    }
+}
+
+/* Hand a read off to the host read thread at command issue time. */
+static void
+ide_prefetch_queue(ide_t *ide, uint32_t count)
+{
+    ide_board_t *dev = ide_boards[ide->board];
+
+    if ((ide->type != IDE_HDD) || (dev->read_thread == NULL))
+        return;
+
+    ide->prefetch_sector = ide_get_sector(ide);
+    ide->prefetch_count  = count;
+    ide->prefetch_seq++;
+    ide->prefetch_state  = PREFETCH_QUEUED;
+
+    thread_set_event(dev->wake_read_thread);
+}
+
+/* Collect the result of a queued read: 0 = data resident (*ret filled in),
+   1 = still in flight (re-arm the timer), -1 = nothing queued (read here). */
+static int
+ide_prefetch_fetch(ide_t *ide, int *ret)
+{
+    if (ide->prefetch_state != PREFETCH_DONE)
+        return (ide->prefetch_state == PREFETCH_QUEUED) ? 1 : -1;
+
+    ide->prefetch_state = PREFETCH_IDLE;
+
+    /* A stale result from a superseded command - ignore it. */
+    if (ide->prefetch_done_seq != ide->prefetch_seq)
+        return -1;
+
+    *ret = ide->prefetch_ret;
+    return 0;
+}
+
 void
 ide_set_board_callback(uint8_t board, double callback)
 {
@@ -1480,6 +1568,10 @@ dev_reset(ide_t *ide)
 {
     ide_set_signature(ide);
 
+    /* Invalidate any host read still in flight for the aborted command. */
+    ide->prefetch_seq++;
+    ide->prefetch_state = PREFETCH_IDLE;
+
     if ((ide->type == IDE_ATAPI) && ide->stop)
         ide->stop(ide->sc);
 }
@@ -1799,6 +1891,7 @@ ide_writeb(uint16_t addr, uint8_t val, void *priv)
                         } else if ((val == WIN_READ_MULTIPLE) && (hdd[ide->hdd_num].speed_preset == 0)) {
                            ide_set_callback(ide, 200.0 * IDE_TIME);
                            ide->do_initial_read = 1;
+                           ide_prefetch_queue(ide, ide->tf->secount ? ide->tf->secount : 256);
                            break;
                         } else if ((val == WIN_READ_MULTIPLE) && (ide->blocksize > 0)) {
                             sec_count = ide->tf->secount ? ide->tf->secount : 256;
@@ -1821,6 +1914,8 @@ ide_writeb(uint16_t addr, uint8_t val, void *priv)
                     } else
                         ide_set_callback(ide, 200.0 * IDE_TIME);
                     ide->do_initial_read = 1;
+                    if (ide->type == IDE_HDD)
+                        ide_prefetch_queue(ide, ide->tf->secount ? ide->tf->secount : 256);
                     break;
 
                 case WIN_WRITE_MULTIPLE:
@@ -2357,10 +2452,21 @@ ide_callback(void *priv)
                 err = IDNF_ERR;
             else {
                 if (ide->do_initial_read) {
+                    switch (ide_prefetch_fetch(ide, &ret)) {
+                        case 1:
+                            /* The host read thread is still busy - check back shortly. */
+                            ide_set_callback(ide, 10.0 * IDE_TIME);
+                            return;
+                        case -1:
+                            ret = hdd_image_read(ide->hdd_num, ide_get_sector(ide),
+                                                 ide->tf->secount ? ide->tf->secount : 256,
+                                                 ide->sector_buffer);
+                            break;
+                        default:
+                            break;
+                    }
                     ide->do_initial_read = 0;
                     ide->sector_pos      = 0;
-                    ret = hdd_image_read(ide->hdd_num, ide_get_sector(ide),
-                                         ide->tf->secount ? ide->tf->secount : 256, ide->sector_buffer);
                 } else
                     ret = 0;
 
@@ -2398,7 +2504,20 @@ ide_callback(void *priv)
 
                 ide->tf->pos = 0;
 
-                if (hdd_image_read(ide->hdd_num, ide_get_sector(ide), ide->sector_pos, ide->sector_buffer) < 0) {
+                switch (ide_prefetch_fetch(ide, &ret)) {
+                    case 1:
+                        /* The host read thread is still busy - check back shortly. */
+                        ide_set_callback(ide, 10.0 * IDE_TIME);
+                        return;
+                    case -1:
+                        ret = hdd_image_read(ide->hdd_num, ide_get_sector(ide),
+                                             ide->sector_pos, ide->sector_buffer);
+                        break;
+                    default:
+                        break;
+                }
+
+                if (ret < 0) {
                     ide_log("IDE %i: DMA read aborted (image read error)\n", ide->channel);
                     err = UNC_ERR;
                 } else if (!ide_boards[ide->board]->force_ata3 && bm->dma) {
@@ -2442,10 +2561,21 @@ ide_callback(void *priv)
                 err = IDNF_ERR;
             else {
                 if (ide->do_initial_read) {
+                    switch (ide_prefetch_fetch(ide, &ret)) {
+                        case 1:
+                            /* The host read thread is still busy - check back shortly. */
+                            ide_set_callback(ide, 10.0 * IDE_TIME);
+                            return;
+                        case -1:
+                            ret = hdd_image_read(ide->hdd_num, ide_get_sector(ide),
+                                                 ide->tf->secount ? ide->tf->secount : 256,
+                                                 ide->sector_buffer);
+                            break;
+                        default:
+                            break;
+                    }
                     ide->do_initial_read = 0;
                     ide->sector_pos      = 0;
-                    ret = hdd_image_read(ide->hdd_num, ide_get_sector(ide),
-                                         ide->tf->secount ? ide->tf->secount : 256, ide->sector_buffer);
                 } else {
                     ret = 0;
                 }
@@ -2845,6 +2975,16 @@ ide_board_close(int board)
         ide_clear_bus_master(board);
     }
 
+    /* Stop the host read thread before the drives and their buffers go away. */
+    if (ide_boards[board]->read_thread != NULL) {
+        ide_boards[board]->read_thread_run = 0;
+        thread_set_event(ide_boards[board]->wake_read_thread);
+        thread_wait(ide_boards[board]->read_thread);
+        thread_destroy_event(ide_boards[board]->wake_read_thread);
+        ide_boards[board]->read_thread      = NULL;
+        ide_boards[board]->wake_read_thread = NULL;
+    }
+
     /* Close hard disk image files (if previously open) */
     for (uint8_t d = 0; d < 2; d++) {
         c = (board << 1) + d;
@@ -2981,6 +3121,10 @@ ide_board_init(int board, int irq, int base_main, int side_main, int type, int b
 
     ide_board_setup(board);
 
+    ide_boards[board]->read_thread_run = 1;
+    ide_boards[board]->wake_read_thread = thread_create_event();
+    ide_boards[board]->read_thread = thread_create(ide_read_thread, ide_boards[board]);
+
     ide_boards[board]->inited = 1;
 }
 
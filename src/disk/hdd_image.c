@@ -33,6 +33,7 @@
 #include <86box/plat.h>
 #include <86box/random.h>
 #include <86box/hdd.h>
+#include <minitrace/minitrace.h>
 #include "minivhd/minivhd.h"
 #include "minivhd/internal.h"
 
@@ -41,14 +42,25 @@
 #define HDD_IMAGE_HDX 2
 #define HDD_IMAGE_VHD 3
 
+/* Readahead cache span in sectors (must be a power of two) - 128 KB per
+   image, allocated on first read. Guests doing single-sector PIO reads get
+   served from the cache instead of paying one host seek+read per sector. */
+#define HDD_CACHE_SECTORS 256
+
 typedef struct hdd_image_t {
     FILE     *file; /* Used for HDD_IMAGE_RAW, HDD_IMAGE_HDI, and HDD_IMAGE_HDX. */
     MVHDMeta *vhd;  /* Used for HDD_IMAGE_VHD. */
+    uint8_t  *mapping; /* Shared file mapping of the whole image, NULL if unavailable. */
+    uint64_t  map_size;
+    uint8_t  *cache;
+    uint32_t  cache_start;
+    uint32_t  cache_count; /* 0 = cache empty */
     uint32_t  base;
     uint32_t  pos;
     uint32_t  last_sector;
     uint8_t   type; /* HDD_IMAGE_RAW, HDD_IMAGE_HDI, HDD_IMAGE_HDX, or HDD_IMAGE_VHD */
     uint8_t   loaded;
+    uint8_t   map_tried;
 } hdd_image_t;
 
 hdd_image_t hdd_images[HDD_NUM];
@@ -525,8 +537,76 @@ hdd_image_seek(uint8_t id, uint32_t sector)
     return 0;
 }
 
-int
-hdd_image_read(uint8_t id, uint32_t sector, uint32_t count, uint8_t *buffer)
+/* Map the whole image file into memory once, on first access. Sector I/O
+   then degenerates to memcpy through the host page cache; writes through a
+   shared mapping land in the page cache just like fwrite+fflush did, so
+   durability is unchanged. Stays NULL (stdio path) if the host can't map
+   the file, e.g. images larger than the address space on 32-bit hosts. */
+static void
+hdd_image_try_mmap(uint8_t id)
+{
+    hdd_image_t *img = &hdd_images[id];
+
+    if (img->map_tried || !img->file)
+        return;
+
+    img->map_tried = 1;
+    img->map_size  = (uint64_t) img->base + (((uint64_t) img->last_sector + 1) << 9LL);
+    img->mapping   = plat_mmap_file(img->file, img->map_size);
+    if (!img->mapping)
+        hdd_image_log("Hard disk image %i: mmap unavailable, using stdio\n", id);
+}
+
+/* Serve a read from the readahead cache, refilling it with one aligned
+   fread on a miss. Returns -1 if the span could not be covered (short read
+   at end of file); the caller then falls back to the direct path. */
+static int
+hdd_image_cache_read(uint8_t id, uint32_t sector, uint32_t count, uint8_t *buffer)
+{
+    hdd_image_t *img  = &hdd_images[id];
+    uint32_t     done = 0;
+    uint32_t     cur;
+    uint32_t     start;
+    uint32_t     span;
+    uint32_t     run;
+    size_t       num_read;
+
+    if (!img->cache) {
+        img->cache = malloc(HDD_CACHE_SECTORS << 9);
+        if (!img->cache)
+            return -1;
+        img->cache_count = 0;
+    }
+
+    while (done < count) {
+        cur = sector + done;
+
+        if (!img->cache_count || (cur < img->cache_start) || (cur >= (img->cache_start + img->cache_count))) {
+            start = cur & ~(HDD_CACHE_SECTORS - 1);
+            span  = HDD_CACHE_SECTORS;
+            if ((start + span) > (img->last_sector + 1))
+                span = (img->last_sector + 1) - start;
+
+            img->cache_count = 0;
+            if (fseeko64(img->file, ((uint64_t) start << 9LL) + img->base, SEEK_SET) == -1)
+                return -1;
+            num_read         = fread(img->cache, 512, span, img->file);
+            img->cache_start = start;
+            img->cache_count = (uint32_t) num_read;
+            if ((cur < start) || (cur >= (start + num_read)))
+                return -1;
+        }
+
+        run = MIN(count - done, (img->cache_start + img->cache_count) - cur);
+        memcpy(&buffer[done << 9], &img->cache[(cur - img->cache_start) << 9], run << 9);
+        done += run;
+    }
+
+    return 0;
+}
+
+static int
+do_hdd_image_read(uint8_t id, uint32_t sector, uint32_t count, uint8_t *buffer)
 {
     int    non_transferred_sectors;
     size_t num_read;
@@ -538,6 +618,20 @@ hdd_image_read(uint8_t id, uint32_t sector, uint32_t count, uint8_t *buffer)
         if (hdd_images[id].vhd->error)
             return -1;
     } else {
+        hdd_image_try_mmap(id);
+
+        if (hdd_images[id].mapping && ((sector + count) <= (hdd_images[id].last_sector + 1))) {
+            memcpy(buffer, &hdd_images[id].mapping[hdd_images[id].base + ((uint64_t) sector << 9LL)], (size_t) count << 9);
+            hdd_images[id].pos = sector + count;
+            return 0;
+        }
+
+        if (hdd_images[id].file && ((sector + count) <= (hdd_images[id].last_sector + 1))
+            && (hdd_image_cache_read(id, sector, count, buffer) == 0)) {
+            hdd_images[id].pos = sector + count;
+            return 0;
+        }
+
         if (!hdd_images[id].file || (fseeko64(hdd_images[id].file, ((uint64_t) (sector) << 9LL) + hdd_images[id].base, SEEK_SET) == -1)) {
             hdd_image_log("Hard disk image %i: Read error during seek\n", id);
             return -1;
@@ -552,6 +646,16 @@ hdd_image_read(uint8_t id, uint32_t sector, uint32_t count, uint8_t *buffer)
     return 0;
 }
 
+int
+hdd_image_read(uint8_t id, uint32_t sector, uint32_t count, uint8_t *buffer)
+{
+    MTR_BEGIN_I("hdd", "hdd_image_read", "count", count);
+    int ret = do_hdd_image_read(id, sector, count, buffer);
+    MTR_END("hdd", "hdd_image_read");
+
+    return ret;
+}
+
 uint32_t
 hdd_image_get_last_sector(uint8_t id)
 {
@@ -581,8 +685,8 @@ hdd_image_read_ex(uint8_t id, uint32_t sector, uint32_t count, uint8_t *buffer)
     return 0;
 }
 
-int
-hdd_image_write(uint8_t id, uint32_t sector, uint32_t count, uint8_t *buffer)
+static int
+do_hdd_image_write(uint8_t id, uint32_t sector, uint32_t count, uint8_t *buffer)
 {
     int    non_transferred_sectors;
     size_t num_write;
@@ -594,6 +698,14 @@ hdd_image_write(uint8_t id, uint32_t sector, uint32_t count, uint8_t *buffer)
         if (hdd_images[id].vhd->error)
             return -1;
     } else {
+        hdd_image_try_mmap(id);
+
+        if (hdd_images[id].mapping && ((sector + count) <= (hdd_images[id].last_sector + 1))) {
+            memcpy(&hdd_images[id].mapping[hdd_images[id].base + ((uint64_t) sector << 9LL)], buffer, (size_t) count << 9);
+            hdd_images[id].pos = sector + count;
+            return 0;
+        }
+
         if (!hdd_images[id].file || (fseeko64(hdd_images[id].file, ((uint64_t) (sector) << 9LL) + hdd_images[id].base, SEEK_SET) == -1)) {
             hdd_image_log("Hard disk image %i: Write error during seek\n", id);
             return -1;
@@ -601,7 +713,25 @@ hdd_image_write(uint8_t id, uint32_t sector, uint32_t count, uint8_t *buffer)
 
         num_write          = fwrite(buffer, 512, count, hdd_images[id].file);
         hdd_images[id].pos = sector + num_write;
+        /* Not a durability barrier - this only pushes the stdio buffer
+           to the page cache so the mmap read path sees the new data.
+           Nothing here or elsewhere calls fsync(); host write-back is
+           left entirely to the OS. */
         fflush(hdd_images[id].file);
+
+        if (hdd_images[id].cache_count) {
+            uint32_t cache_end = hdd_images[id].cache_start + hdd_images[id].cache_count;
+            uint32_t write_end = sector + (uint32_t) num_write;
+
+            if ((sector < cache_end) && (write_end > hdd_images[id].cache_start)) {
+                uint32_t first = MAX(sector, hdd_images[id].cache_start);
+                uint32_t last  = MIN(write_end, cache_end);
+
+                memcpy(&hdd_images[id].cache[(first - hdd_images[id].cache_start) << 9],
+                       &buffer[(first - sector) << 9], (last - first) << 9);
+            }
+        }
+
         if (num_write < count)
             return -1;
     }
@@ -609,6 +739,16 @@ hdd_image_write(uint8_t id, uint32_t sector, uint32_t count, uint8_t *buffer)
     return 0;
 }
 
+int
+hdd_image_write(uint8_t id, uint32_t sector, uint32_t count, uint8_t *buffer)
+{
+    MTR_BEGIN_I("hdd", "hdd_image_write", "count", count);
+    int ret = do_hdd_image_write(id, sector, count, buffer);
+    MTR_END("hdd", "hdd_image_write");
+
+    return ret;
+}
+
 int
 hdd_image_write_ex(uint8_t id, uint32_t sector, uint32_t count, uint8_t *buffer)
 {
@@ -636,6 +776,14 @@ hdd_image_zero(uint8_t id, uint32_t sector, uint32_t count)
         if (hdd_images[id].vhd->error)
             return -1;
     } else {
+        hdd_image_try_mmap(id);
+
+        if (hdd_images[id].mapping && ((sector + count) <= (hdd_images[id].last_sector + 1))) {
+            memset(&hdd_images[id].mapping[hdd_images[id].base + ((uint64_t) sector << 9LL)], 0, (size_t) count << 9);
+            hdd_images[id].pos = sector + count - 1;
+            return 0;
+        }
+
         memset(empty_sector, 0, 512);
 
         if (!hdd_images[id].file || (fseeko64(hdd_images[id].file, ((uint64_t) (sector) << 9LL) + hdd_images[id].base, SEEK_SET) == -1)) {
@@ -643,6 +791,10 @@ hdd_image_zero(uint8_t id, uint32_t sector, uint32_t count)
             return -1;
         }
 
+        if (hdd_images[id].cache_count && (sector < (hdd_images[id].cache_start + hdd_images[id].cache_count))
+            && ((sector + count) > hdd_images[id].cache_start))
+            hdd_images[id].cache_count = 0;
+
         for (uint32_t i = 0; i < count; i++) {
             if (feof(hdd_images[id].file))
                 break;
@@ -700,6 +852,16 @@ hdd_image_unload(uint8_t id, UNUSED(int fn_preserve))
             mvhd_close(hdd_images[id].vhd);
             hdd_images[id].vhd = NULL;
         }
+        if (hdd_images[id].mapping != NULL) {
+            plat_munmap_file(hdd_images[id].mapping, hdd_images[id].map_size);
+            hdd_images[id].mapping   = NULL;
+            hdd_images[id].map_tried = 0;
+        }
+        if (hdd_images[id].cache != NULL) {
+            free(hdd_images[id].cache);
+            hdd_images[id].cache       = NULL;
+            hdd_images[id].cache_count = 0;
+        }
         hdd_images[id].loaded = 0;
     }
 
@@ -724,6 +886,16 @@ hdd_image_close(uint8_t id)
         hdd_images[id].vhd = NULL;
     }
 
+    if (hdd_images[id].mapping != NULL) {
+        plat_munmap_file(hdd_images[id].mapping, hdd_images[id].map_size);
+        hdd_images[id].mapping = NULL;
+    }
+
+    if (hdd_images[id].cache != NULL) {
+        free(hdd_images[id].cache);
+        hdd_images[id].cache = NULL;
+    }
+
     memset(&hdd_images[id], 0, sizeof(hdd_image_t));
     hdd_images[id].loaded = 0;
 }
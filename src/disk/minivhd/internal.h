@@ -60,11 +60,17 @@
 
 #define MVHD_START_TS          946684800
 
+/* Number of per-block sector bitmaps kept cached in memory. */
+#define MVHD_BITMAP_CACHE_ENTRIES 16
 
 typedef struct MVHDSectorBitmap {
     uint8_t* curr_bitmap;
     int      sector_count;
     int      curr_block;
+    uint8_t* cache; /* MVHD_BITMAP_CACHE_ENTRIES bitmaps; curr_bitmap points into it */
+    int      cache_block[MVHD_BITMAP_CACHE_ENTRIES];
+    uint64_t cache_stamp[MVHD_BITMAP_CACHE_ENTRIES];
+    uint64_t stamp;
 } MVHDSectorBitmap;
 
 typedef struct MVHDFooter {
@@ -97,10 +97,27 @@ mvhd_write_empty_sectors(FILE *f, int sector_count)
 }
 
 /**
- * \brief Read the sector bitmap for a block.
+ * \brief Get a pointer to a cached sector bitmap slot
  *
- * If the block is sparse, the sector bitmap in memory will be
- * zeroed. Otherwise, the sector bitmap is read from the VHD file.
+ * \param [in] vhdm MiniVHD data structure
+ * \param [in] slot The cache slot to get the bitmap pointer for
+ */
+static uint8_t*
+bitmap_cache_slot(MVHDMeta *vhdm, int slot)
+{
+    return vhdm->bitmap.cache + ((size_t)slot * vhdm->bitmap.sector_count * MVHD_SECTOR_SIZE);
+}
+
+/**
+ * \brief Make the sector bitmap for a block the current bitmap.
+ *
+ * Bitmaps are kept in a small LRU cache, so repeatedly hopping between
+ * blocks does not re-read the bitmaps from file. On a cache miss the
+ * least recently used entry is replaced: if the block is sparse, the
+ * bitmap is zeroed, otherwise it is read from the VHD file.
+ *
+ * Note that unlike earlier versions, this function leaves the file
+ * position undefined; callers must seek to the data they need.
  *
  * \param [in] vhdm MiniVHD data structure
  * \param [in] blk The block for which to read the sector bitmap from
@@ -108,13 +125,31 @@ mvhd_write_empty_sectors(FILE *f, int sector_count)
 static void
 read_sect_bitmap(MVHDMeta *vhdm, int blk)
 {
-    if (vhdm->block_offset[blk] != MVHD_SPARSE_BLK) {
-        mvhd_fseeko64(vhdm->f, (uint64_t)vhdm->block_offset[blk] * MVHD_SECTOR_SIZE, SEEK_SET);
-        if (!fread(vhdm->bitmap.curr_bitmap, vhdm->bitmap.sector_count * MVHD_SECTOR_SIZE, 1, vhdm->f))
-            vhdm->error = 1;
-    } else
-        memset(vhdm->bitmap.curr_bitmap, 0, vhdm->bitmap.sector_count * MVHD_SECTOR_SIZE);
+    int hit = -1;
+    int evict = 0;
+
+    for (int i = 0; i < MVHD_BITMAP_CACHE_ENTRIES; i++) {
+        if (vhdm->bitmap.cache_block[i] == blk) {
+            hit = i;
+            break;
+        }
+        if (vhdm->bitmap.cache_stamp[i] < vhdm->bitmap.cache_stamp[evict])
+            evict = i;
+    }
 
+    if (hit < 0) {
+        hit = evict;
+        vhdm->bitmap.cache_block[hit] = blk;
+        if (vhdm->block_offset[blk] != MVHD_SPARSE_BLK) {
+            mvhd_fseeko64(vhdm->f, (uint64_t)vhdm->block_offset[blk] * MVHD_SECTOR_SIZE, SEEK_SET);
+            if (!fread(bitmap_cache_slot(vhdm, hit), vhdm->bitmap.sector_count * MVHD_SECTOR_SIZE, 1, vhdm->f))
+                vhdm->error = 1;
+        } else
+            memset(bitmap_cache_slot(vhdm, hit), 0, vhdm->bitmap.sector_count * MVHD_SECTOR_SIZE);
+    }
+
+    vhdm->bitmap.cache_stamp[hit] = ++vhdm->bitmap.stamp;
+    vhdm->bitmap.curr_bitmap = bitmap_cache_slot(vhdm, hit);
     vhdm->bitmap.curr_block = blk;
 }
 
@@ -247,43 +282,75 @@ mvhd_sparse_read(MVHDMeta *vhdm, uint32_t offset, int num_sectors, void *out_buf
 
     uint8_t* buff = (uint8_t*)out_buff;
     int64_t addr = 0ULL;
-    uint32_t s = 0;
-    uint32_t ls = 0;
-    int blk = 0;
-    int prev_blk = -1;
-    int sib = 0;
-    ls = offset + transfer_sectors;
-
-    for (s = offset; s < ls; s++) {
-        blk = s / vhdm->sect_per_block;
-        sib = s % vhdm->sect_per_block;
-        if (blk != prev_blk) {
-            prev_blk = blk;
-            if (vhdm->bitmap.curr_block != blk) {
-                read_sect_bitmap(vhdm, blk);
-                if (mvhd_fseeko64(vhdm->f, (uint64_t)sib * MVHD_SECTOR_SIZE, SEEK_CUR) == -1)
-                    vhdm->error = 1;
-            } else {
-                addr = (((int64_t) vhdm->block_offset[blk]) + vhdm->bitmap.sector_count + sib) *
+    uint32_t s = offset;
+    uint32_t ls = offset + transfer_sectors;
+
+    while (s < ls) {
+        int blk = s / vhdm->sect_per_block;
+        int sib = s % vhdm->sect_per_block;
+        uint32_t blk_end = (uint32_t)(blk + 1) * vhdm->sect_per_block;
+        uint32_t span_end = ls < blk_end ? ls : blk_end;
+
+        if (vhdm->bitmap.curr_block != blk)
+            read_sect_bitmap(vhdm, blk);
+
+        /* Coalesce runs of present and absent sectors within the block, so
+           each run costs one fread or one memset instead of one per sector. */
+        while (s < span_end) {
+            int run_present = VHD_TESTBIT(vhdm->bitmap.curr_bitmap, sib) != 0;
+            int run_sib = sib;
+            uint32_t run_start = s;
+            size_t run_bytes;
+
+            while ((s < span_end) && ((VHD_TESTBIT(vhdm->bitmap.curr_bitmap, sib) != 0) == run_present)) {
+                s++;
+                sib++;
+            }
+            run_bytes = (size_t)(s - run_start) * MVHD_SECTOR_SIZE;
+
+            if (run_present) {
+                addr = (((int64_t) vhdm->block_offset[blk]) + vhdm->bitmap.sector_count + run_sib) *
                        MVHD_SECTOR_SIZE;
                 if (mvhd_fseeko64(vhdm->f, addr, SEEK_SET) == -1)
                     vhdm->error = 1;
-            }
-        }
-
-        if (VHD_TESTBIT(vhdm->bitmap.curr_bitmap, sib)) {
-            if (!fread(buff, MVHD_SECTOR_SIZE, 1, vhdm->f) && !feof(vhdm->f))
-                vhdm->error = 1;
-        } else {
-            memset(buff, 0, MVHD_SECTOR_SIZE);
-            mvhd_fseeko64(vhdm->f, MVHD_SECTOR_SIZE, SEEK_CUR);
+                if (!fread(buff, run_bytes, 1, vhdm->f) && !feof(vhdm->f))
+                    vhdm->error = 1;
+            } else
+                memset(buff, 0, run_bytes);
+            buff += run_bytes;
         }
-        buff += MVHD_SECTOR_SIZE;
     }
 
     return truncated_sectors;
 }
 
+/**
+ * \brief Find the image in a differencing chain which holds a sector
+ *
+ * Walks from the given differencing image towards the root, until an image
+ * is found whose sector bitmap claims the sector (or the chain ends).
+ *
+ * \param [in] vhdm MiniVHD data structure of the differencing image
+ * \param [in] s The absolute sector number to look for
+ */
+static MVHDMeta*
+diff_find_layer(MVHDMeta *vhdm, uint32_t s)
+{
+    MVHDMeta *curr_vhdm = vhdm;
+
+    while (curr_vhdm->footer.disk_type == MVHD_TYPE_DIFF) {
+        int blk = s / curr_vhdm->sect_per_block;
+        int sib = s % curr_vhdm->sect_per_block;
+        if (curr_vhdm->bitmap.curr_block != blk)
+            read_sect_bitmap(curr_vhdm, blk);
+        if (VHD_TESTBIT(curr_vhdm->bitmap.curr_bitmap, sib))
+            break;
+        curr_vhdm = curr_vhdm->parent;
+    }
+
+    return curr_vhdm;
+}
+
 int
 mvhd_diff_read(MVHDMeta *vhdm, uint32_t offset, int num_sectors, void *out_buff)
 {
@@ -294,39 +361,36 @@ mvhd_diff_read(MVHDMeta *vhdm, uint32_t offset, int num_sectors, void *out_buff)
     check_sectors(offset, num_sectors, total_sectors, &transfer_sectors, &truncated_sectors);
 
     uint8_t *buff = (uint8_t*)out_buff;
-    MVHDMeta *curr_vhdm = vhdm;
-    uint32_t s = 0;
-    uint32_t ls = 0;
-    int blk = 0;
-    int sib = 0;
-    ls = offset + transfer_sectors;
-
-    for (s = offset; s < ls; s++) {
-        while (curr_vhdm->footer.disk_type == MVHD_TYPE_DIFF) {
-            blk = s / curr_vhdm->sect_per_block;
-            sib = s % curr_vhdm->sect_per_block;
-            if (curr_vhdm->bitmap.curr_block != blk) {
-                read_sect_bitmap(curr_vhdm, blk);
-            }
-            if (!VHD_TESTBIT(curr_vhdm->bitmap.curr_bitmap, sib)) {
-                curr_vhdm = curr_vhdm->parent;
-            } else { break; }
-        }
+    MVHDMeta *curr_vhdm;
+    uint32_t s = offset;
+    uint32_t ls = offset + transfer_sectors;
+    uint32_t run_start;
+    int run;
+
+    while (s < ls) {
+        curr_vhdm = diff_find_layer(vhdm, s);
+
+        /* Extend the run for as long as the same image in the chain keeps
+           serving the sectors, then read the whole run in one go. */
+        run_start = s;
+        do
+            s++;
+        while ((s < ls) && (diff_find_layer(vhdm, s) == curr_vhdm));
+        run = (int)(s - run_start);
 
         /* We handle actual sector reading using the fixed or sparse functions,
            as a differencing VHD is also a sparse VHD */
         if ((curr_vhdm->footer.disk_type == MVHD_TYPE_DIFF) ||
             (curr_vhdm->footer.disk_type == MVHD_TYPE_DYNAMIC))
-            mvhd_sparse_read(curr_vhdm, s, 1, buff);
+            mvhd_sparse_read(curr_vhdm, run_start, run, buff);
         else
-            mvhd_fixed_read(curr_vhdm, s, 1, buff);
+            mvhd_fixed_read(curr_vhdm, run_start, run, buff);
         if (curr_vhdm->error) {
             curr_vhdm->error = 0;
             vhdm->error = 1;
         }
 
-        curr_vhdm = vhdm;
-        buff += MVHD_SECTOR_SIZE;
+        buff += (size_t)run * MVHD_SECTOR_SIZE;
     }
 
     return truncated_sectors;
@@ -363,53 +427,42 @@ mvhd_sparse_diff_write(MVHDMeta *vhdm, uint32_t offset, int num_sectors, void *i
 
     uint8_t* buff = (uint8_t *) in_buff;
     int64_t addr = 0ULL;
-    uint32_t s = 0;
-    uint32_t ls = 0;
-    int blk = 0;
-    int prev_blk = -1;
-    int sib = 0;
-    ls = offset + transfer_sectors;
+    uint32_t s = offset;
+    uint32_t ls = offset + transfer_sectors;
 
     if (offset < total_sectors) {
-        for (s = offset; s < ls; s++) {
-            blk = s / vhdm->sect_per_block;
-            sib = s % vhdm->sect_per_block;
-            if (vhdm->bitmap.curr_block != blk && prev_blk >= 0) {
-                /* Write the sector bitmap for the previous block, before we replace it. */
-                write_curr_sect_bitmap(vhdm);
-            }
+        while (s < ls) {
+            int blk = s / vhdm->sect_per_block;
+            int sib = s % vhdm->sect_per_block;
+            uint32_t blk_end = (uint32_t)(blk + 1) * vhdm->sect_per_block;
+            uint32_t span_end = ls < blk_end ? ls : blk_end;
+            size_t span_bytes = (size_t)(span_end - s) * MVHD_SECTOR_SIZE;
 
             if (vhdm->block_offset[blk] == MVHD_SPARSE_BLK) {
                 /* "read" the sector bitmap first, before creating a new block, as the bitmap will be
                    zero either way */
                 read_sect_bitmap(vhdm, blk);
                 create_block(vhdm, blk);
-            }
-
-            if (blk != prev_blk) {
-                if (vhdm->bitmap.curr_block != blk) {
-                    read_sect_bitmap(vhdm, blk);
-                    if (mvhd_fseeko64(vhdm->f, (uint64_t)sib * MVHD_SECTOR_SIZE, SEEK_CUR) == -1)
-                        vhdm->error = 1;
-                } else {
-                    addr = (((int64_t) vhdm->block_offset[blk]) + vhdm->bitmap.sector_count + sib) *
-                           MVHD_SECTOR_SIZE;
-                    if (mvhd_fseeko64(vhdm->f, addr, SEEK_SET) == -1)
-                        vhdm->error = 1;
-                }
-                prev_blk = blk;
-            }
+            } else if (vhdm->bitmap.curr_block != blk)
+                read_sect_bitmap(vhdm, blk);
 
-            if (!fwrite(buff, MVHD_SECTOR_SIZE, 1, vhdm->f))
+            /* The span is contiguous within the block, so write it with a
+               single fwrite, followed by one bitmap update for the block. */
+            addr = (((int64_t) vhdm->block_offset[blk]) + vhdm->bitmap.sector_count + sib) *
+                   MVHD_SECTOR_SIZE;
+            if (mvhd_fseeko64(vhdm->f, addr, SEEK_SET) == -1)
+                vhdm->error = 1;
+            if (!fwrite(buff, span_bytes, 1, vhdm->f))
                 vhdm->error = 1;
-            VHD_SETBIT(vhdm->bitmap.curr_bitmap, sib);
-            buff += MVHD_SECTOR_SIZE;
+            for (uint32_t i = s; i < span_end; i++)
+                VHD_SETBIT(vhdm->bitmap.curr_bitmap, (int)(sib + (i - s)));
+            write_curr_sect_bitmap(vhdm);
+
+            buff += span_bytes;
+            s = span_end;
         }
     }
 
-    /* And write the sector bitmap for the last block we visited to disk */
-    write_curr_sect_bitmap(vhdm);
-
     fflush(vhdm->f);
 
     return truncated_sectors;
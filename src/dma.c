@@ -1880,10 +1880,8 @@ dma_bm_read(uint32_t PhysAddress, uint8_t *DataRead, uint32_t TotalSize, int Tra
     n2 = TotalSize - n;
 
     /* Do the divisible block, if there is one. */
-    if (n) {
-        for (uint32_t i = 0; i < n; i += TransferSize)
-            mem_read_phys((void *) &(DataRead[i]), PhysAddress + i, TransferSize);
-    }
+    if (n)
+        mem_read_phys_bulk((void *) DataRead, PhysAddress, n, TransferSize);
 
     /* Do the non-divisible block, if there is one. */
     if (n2) {
@@ -1903,10 +1901,8 @@ dma_bm_write(uint32_t PhysAddress, const uint8_t *DataWrite, uint32_t TotalSize,
     n2 = TotalSize - n;
 
     /* Do the divisible block, if there is one. */
-    if (n) {
-        for (uint32_t i = 0; i < n; i += TransferSize)
-            mem_write_phys((void *) &(DataWrite[i]), PhysAddress + i, TransferSize);
-    }
+    if (n)
+        mem_write_phys_bulk((const void *) DataWrite, PhysAddress, n, TransferSize);
 
     /* Do the non-divisible block, if there is one. */
     if (n2) {
@@ -2318,6 +2318,16 @@ d86f_sector_is_present(int drive, int side, uint8_t c, uint8_t h, uint8_t r, uin
     return 0;
 }
 
+/* Turbo mode is the decoded fast path: it answers the FDC from the
+   per-side sector list and the handler's byte buffers, skipping the
+   bitcell state machines entirely.  It is a per-drive option rather
+   than an automatic cache on the normal path because the bitcell poll
+   is not just slow decode - its pacing is the emulation.  Weak bits,
+   fuzzy sectors and gap timing games only behave because every bit is
+   clocked through d86f_get_bit() at the right time, so a transparent
+   "serve from cache when the track looks plain" shortcut would change
+   guest-visible timing on exactly the copy-protected disks where it
+   matters.  Users pick per drive: accurate or fast. */
 void
 d86f_turbo_poll(int drive, int side)
 {
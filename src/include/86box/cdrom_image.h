@@ -33,6 +33,9 @@ typedef struct track_file_t {
     int motorola;
 } track_file_t;
 
+/* Preload whole binary images into memory on mount. */
+extern int cdrom_image_preload;
+
 extern void *image_open(cdrom_t *dev, const char *path);
 
 #endif /*CDROM_IMAGE_H*/
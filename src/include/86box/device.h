@@ -203,6 +203,10 @@ extern void  device_close_all(void);
 extern void  device_reset_all(uint32_t match_flags);
 extern void *device_find_first_priv(uint32_t match_flags);
 extern void *device_get_priv(const device_t *dev);
+#ifdef USE_INSTRUMENT
+extern void  device_time_add(void *priv, uint64_t time);
+extern void  device_time_dump(void);
+#endif
 extern int   device_available(const device_t *dev);
 extern void  device_speed_changed(void);
 extern void  device_force_redraw(void);
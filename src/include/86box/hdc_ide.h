@@ -96,6 +96,12 @@ typedef struct ide_s {
     int      reset;
     int      mdma_mode;
     int      do_initial_read;
+    int      prefetch_state;
+    int      prefetch_seq;
+    int      prefetch_done_seq;
+    int      prefetch_ret;
+    uint32_t prefetch_sector;
+    uint32_t prefetch_count;
     uint32_t drive;
     uint32_t cfg_spt;
     uint32_t cfg_hpc;
@@ -0,0 +1,81 @@
+/*
+ * 86Box    A hypervisor and IBM PC system emulator that specializes in
+ *          running old operating systems and software designed for IBM
+ *          PC systems and compatibles from 1981 through fairly recent
+ *          system designs based on the PCI bus.
+ *
+ *          This file is part of the 86Box distribution.
+ *
+ *          Definitions for the binary instruction trace sink.
+ *
+ *          The sink writes fixed-size records into a file-backed ring
+ *          buffer shared with an external drain tool, so tracing stays
+ *          cheap enough to leave on at full emulation speed. The file
+ *          starts with an instrtrace_hdr_t; record i lives at slot
+ *          (i & (rec_count - 1)). write_idx counts records ever written,
+ *          so a reader that falls more than rec_count records behind can
+ *          compute exactly how many it lost.
+ *
+ *          Configuration is taken from the environment at first use:
+ *            INSTRTRACE_FILE  path of the ring file (unset = disabled)
+ *            INSTRTRACE_RECS  ring capacity in records (rounded up to a
+ *                             power of two, default 4194304 = 64 MB)
+ *            INSTRTRACE_CS    only trace "min-max" CS selectors, in hex
+ *
+ * Authors: Miran Grca, <mgrca8@gmail.com>
+ *
+ *          Copyright 2026 Miran Grca.
+ */
+#ifndef EMU_INSTRTRACE_H
+#define EMU_INSTRTRACE_H
+#include <stdint.h>
+
+#define INSTRTRACE_MAGIC   0x54363849 /* "I86T" */
+#define INSTRTRACE_VERSION 1
+
+/* Record types. */
+#define INSTRTRACE_INSN  0 /* one interpreted instruction */
+#define INSTRTRACE_BLOCK 1 /* dynarec block dispatch (entry point only) */
+
+typedef struct instrtrace_hdr_t {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t rec_size;
+    uint32_t rec_count; /* ring capacity, power of two */
+    uint64_t write_idx; /* monotonic count of records written */
+} instrtrace_hdr_t;
+
+typedef struct instrtrace_rec_t {
+    uint32_t eip;
+    uint32_t fetchdat; /* first four opcode stream bytes */
+    uint16_t cs_sel;
+    uint16_t flags;     /* FLAGS at dispatch */
+    uint16_t eflags;    /* extended FLAGS at dispatch */
+    uint16_t type;      /* INSTRTRACE_* */
+} instrtrace_rec_t;
+
+#ifdef USE_INSTRTRACE
+
+/* <0 = not yet initialized, 0 = off, >0 = tracing. The hot paths only pay
+   one global load and branch when tracing is off. */
+extern int instrtrace_on;
+
+extern void instrtrace_record(uint16_t cs_sel, uint32_t eip, uint32_t fetchdat, uint32_t eflags, int type);
+
+static __inline void
+instrtrace_instruction(uint16_t cs_sel, uint32_t eip, uint32_t fetchdat, uint32_t eflags)
+{
+    if (instrtrace_on)
+        instrtrace_record(cs_sel, eip, fetchdat, eflags, INSTRTRACE_INSN);
+}
+
+static __inline void
+instrtrace_block(uint16_t cs_sel, uint32_t eip, uint32_t eflags)
+{
+    if (instrtrace_on)
+        instrtrace_record(cs_sel, eip, 0, eflags, INSTRTRACE_BLOCK);
+}
+
+#endif
+
+#endif /*EMU_INSTRTRACE_H*/
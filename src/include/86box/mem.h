@@ -261,11 +261,16 @@ extern uint8_t *rom;
 extern uint32_t biosmask;
 extern uint32_t biosaddr;
 
-extern int        readlookup[256];
+/* Number of pages the software TLB (readlookup2/writelookup2) may hold at
+   once. Must be a power of two; entries are recycled FIFO through the
+   readlookup/writelookup rings. */
+#define MMU_CACHE_SIZE 1024
+
+extern int        readlookup[MMU_CACHE_SIZE];
 extern uintptr_t  old_rl2;
 extern uint8_t    uncached;
 extern int        readlnext;
-extern int        writelookup[256];
+extern int        writelookup[MMU_CACHE_SIZE];
 
 extern int        writelnext;
 extern uint32_t   ram_mapped_addr[64];
@@ -356,6 +361,8 @@ extern uint64_t mmutranslatereal(uint32_t addr, int rw);
 extern uint32_t mmutranslatereal32(uint32_t addr, int rw);
 extern void     addreadlookup(uint32_t virt, uint32_t phys);
 extern void     addwritelookup(uint32_t virt, uint32_t phys);
+extern void     addwritelookup_vram(uint32_t virt, uint8_t *mem);
+extern void     removewritelookup(uint32_t virt);
 
 extern void mem_mapping_set(mem_mapping_t *,
                             uint32_t base,
@@ -413,10 +420,12 @@ extern uint8_t  mem_readb_phys(uint32_t addr);
 extern uint16_t mem_readw_phys(uint32_t addr);
 extern uint32_t mem_readl_phys(uint32_t addr);
 extern void     mem_read_phys(void *dest, uint32_t addr, int tranfer_size);
+extern void     mem_read_phys_bulk(void *dest, uint32_t addr, uint32_t len, int transfer_size);
 extern void     mem_writeb_phys(uint32_t addr, uint8_t val);
 extern void     mem_writew_phys(uint32_t addr, uint16_t val);
 extern void     mem_writel_phys(uint32_t addr, uint32_t val);
 extern void     mem_write_phys(void *src, uint32_t addr, int tranfer_size);
+extern void     mem_write_phys_bulk(const void *src, uint32_t addr, uint32_t len, int transfer_size);
 
 extern uint8_t  mem_read_ram(uint32_t addr, void *priv);
 extern uint16_t mem_read_ramw(uint32_t addr, void *priv);
@@ -449,6 +458,7 @@ extern void flushmmucache(void);
 extern void flushmmucache_write(void);
 extern void flushmmucache_pc(void);
 extern void flushmmucache_nopc(void);
+extern void flushmmucache_2386(void);
 
 extern void mem_debug_check_addr(uint32_t addr, int write);
 
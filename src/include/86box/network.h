@@ -44,6 +44,13 @@
 #define EMU_NETWORK_H
 #include <stdint.h>
 
+#ifdef __cplusplus
+#include <atomic>
+using atomic_int = std::atomic_int;
+#else
+#include <stdatomic.h>
+#endif
+
 /* Network provider types. */
 #define NET_TYPE_NONE     0 /* use the null network driver */
 #define NET_TYPE_SLIRP    1 /* use the SLiRP port forwarder */
@@ -53,6 +60,12 @@
 #define NET_TYPE_NLSWITCH 5 /* use the local switch provider */
 #define NET_TYPE_NRSWITCH 6 /* use the remote switch provider */
 
+/* One standard Ethernet frame (1500 MTU + header + FCS).  This is the
+   emulated wire's contract, not a tunable: every NIC model here is
+   period hardware without TSO/LRO, so their guest drivers never
+   negotiate offloads and a super-sized frame handed up from slirp
+   would simply be malformed traffic to them.  Bulk-transfer speed
+   through slirp is bounded by per-frame emulation cost by design. */
 #define NET_MAX_FRAME  1518
 /* Queue size must be a power of 2 */
 #define NET_QUEUE_LEN      16
@@ -113,12 +126,37 @@ typedef struct netpkt {
     int      len;
 } netpkt_t;
 
+/* Lock-free single-producer/single-consumer ring. head is written only by
+   the producer and tail only by the consumer; each side keeps a cached copy
+   of the other side's index so the shared indices are only re-read when the
+   ring appears full or empty. */
 typedef struct netqueue_t {
-    netpkt_t packets[NET_QUEUE_LEN];
-    int      head;
-    int      tail;
+    netpkt_t   packets[NET_QUEUE_LEN];
+    atomic_int head;
+    atomic_int tail;
+    int        cached_head;
+    int        cached_tail;
 } netqueue_t;
 
+/* Generic receive interrupt coalescing for NIC models: the line assertion is
+   deferred until NET_COAL_FRAMES frames or NET_COAL_USEC microseconds have
+   passed, whichever comes first. Status registers must be updated before
+   deferring, and the fire callback must be the model's idempotent IRQ
+   recompute, so a stale timer fire is harmless. */
+#define NET_COAL_FRAMES 8
+#define NET_COAL_USEC   150.0
+
+typedef struct netcoal_t {
+    pc_timer_t timer;
+    void (*fire)(void *priv);
+    void *priv;
+    int   frames;
+} netcoal_t;
+
+extern void network_coal_init(netcoal_t *coal, void (*fire)(void *priv), void *priv);
+extern void network_coal_defer(netcoal_t *coal);
+extern void network_coal_flush(netcoal_t *coal);
+
 typedef struct _netcard_t netcard_t;
 
 typedef struct netdrv_t {
@@ -143,8 +181,7 @@ struct _netcard_t {
     NETSETLINKSTATE set_link_state;
     netqueue_t      queues[NET_QUEUE_COUNT];
     netpkt_t        queued_pkt;
-    mutex_t        *tx_mutex;
-    mutex_t        *rx_mutex;
+    mutex_t        *rx_mutex; /* serializes RX producers: host poll thread and RTL8139 loopback */
     pc_timer_t      timer;
     uint16_t        card_num;
     double          byte_period;
@@ -188,6 +225,8 @@ extern void       network_close(void);
 extern void       network_reset(void);
 extern int        network_available(void);
 extern void       network_tx(netcard_t *card, uint8_t *, int);
+extern uint8_t   *network_bufpool_get(void);
+extern void       network_bufpool_put(uint8_t *buf);
 
 extern int net_pcap_prepare(netdev_t *);
 extern int net_vde_prepare(void);
@@ -75,6 +75,9 @@ extern void pic_set_pci_flag(int pci);
 extern void pic_set_pci(void);
 extern void pic_kbd_latch(int enable);
 extern void pic_mouse_latch(int enable);
+#ifdef USE_INSTRUMENT
+extern void pic_stats_dump(void);
+#endif
 extern void pic_init(void);
 extern void pic_init_pcjr(void);
 extern void pic2_init(void);
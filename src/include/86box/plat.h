@@ -124,6 +124,7 @@ extern int fullscreen_ui_visible;
 extern FILE    *plat_fopen(const char *path, const char *mode);
 extern FILE    *plat_fopen64(const char *path, const char *mode);
 extern void     plat_remove(char *path);
+extern void     plat_rename(char *old_path, char *new_path);
 extern int      plat_getcwd(char *bufp, int max);
 extern int      plat_chdir(char *path);
 extern void     plat_tempfile(char *bufp, char *prefix, char *suffix);
@@ -138,7 +139,10 @@ extern int      plat_dir_check(char *path);
 extern int      plat_file_check(const char *path);
 extern int      plat_dir_create(char *path);
 extern void    *plat_mmap(size_t size, uint8_t executable);
+extern void     plat_mmap_zero(void *ptr, size_t size);
 extern void     plat_munmap(void *ptr, size_t size);
+extern void    *plat_mmap_file(FILE *fp, uint64_t size);
+extern void     plat_munmap_file(void *ptr, uint64_t size);
 extern uint64_t plat_timer_read(void);
 extern uint32_t plat_get_ticks(void);
 extern void     plat_delay_ms(uint32_t count);
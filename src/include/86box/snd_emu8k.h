@@ -195,21 +195,6 @@ typedef struct emu8k_voice_t {
             uint16_t vtft_vol_target; /* written to by the envelope engine. */
         };
     };
-    /* These registers are used at least by the Windows drivers, and seem to be resetting
-     * something, similarly to targets and current, but... of what?
-     * what is curious is that if they are already zero, they are not written to, so it really
-     * looks like they are information about the status of the channel. (lfo position maybe?) */
-    uint32_t z2;
-    uint32_t z1;
-    union {
-        uint32_t psst;
-        struct {
-            uint16_t psst_lw_address;
-            uint8_t  psst_hw_address;
-            uint8_t  psst_pan;
-        };
-#define PSST_LOOP_START_MASK 0x00FFFFFF /* In samples, i.e. uint16_t array[BOARD_RAM/2]; */
-    };
     union {
         uint32_t csl;
         struct {
@@ -234,6 +219,63 @@ typedef struct emu8k_voice_t {
 #define CCCA_DMA_WRITE_MODE(ccca)  (ccca & 0x02000000)
 #define CCCA_DMA_WRITE_RIGHT(ccca) (ccca & 0x01000000)
 
+    /* The fields below, up to the filter data, are the ones the sample loop
+       touches on every sample of every active voice; they are kept together,
+       ahead of the registers that only matter on I/O accesses, so a voice's
+       per-sample working set spans as few cache lines as possible. */
+    int env_engine_on;
+
+    emu8k_mem_internal_t addr;
+    emu8k_mem_internal_t loop_start;
+    emu8k_mem_internal_t loop_end;
+
+    int32_t initial_att;
+    int32_t initial_filter;
+
+    emu8k_envelope_t vol_envelope;
+    emu8k_envelope_t mod_envelope;
+
+    int64_t              lfo1_speed;
+    int64_t              lfo2_speed;
+    emu8k_mem_internal_t lfo1_count;
+    emu8k_mem_internal_t lfo2_count;
+    int32_t              lfo1_delay_samples;
+    int32_t              lfo2_delay_samples;
+    int                  vol_l;
+    int                  vol_r;
+
+    int16_t fixed_modenv_filter_height;
+    int16_t fixed_modenv_pitch_height;
+    int16_t fixed_lfo1_filt_mod;
+    int16_t fixed_lfo1_vibrato;
+    int16_t fixed_lfo1_tremolo;
+    int16_t fixed_lfo2_vibrato;
+
+    uint16_t ip;
+#define INTIAL_PITCH_CENTER 0xE000
+#define INTIAL_PITCH_OCTAVE 0x1000
+
+    /* filter internal data. */
+    int     filterq_idx;
+    int32_t filt_att;
+    int64_t filt_buffer[5];
+
+    /* These registers are used at least by the Windows drivers, and seem to be resetting
+     * something, similarly to targets and current, but... of what?
+     * what is curious is that if they are already zero, they are not written to, so it really
+     * looks like they are information about the status of the channel. (lfo position maybe?) */
+    uint32_t z2;
+    uint32_t z1;
+    union {
+        uint32_t psst;
+        struct {
+            uint16_t psst_lw_address;
+            uint8_t  psst_hw_address;
+            uint8_t  psst_pan;
+        };
+#define PSST_LOOP_START_MASK 0x00FFFFFF /* In samples, i.e. uint16_t array[BOARD_RAM/2]; */
+    };
+
     uint16_t envvol;
 #define ENVVOL_NODELAY(envol) (envvol & 0x8000)
 /* Verified with a soundfont bank. 7FFF is the minimum delay time, and 0 is the max delay time */
@@ -274,10 +316,6 @@ typedef struct emu8k_voice_t {
 #define ATKHLD_HOLD_TO_EMU_SAMPLES(atkhld) (4096 * (0x7F - ((atkhld >> 8) & 0x7F)))
 #define ATKHLD_ATTACK(atkhld)              (atkhld & 0x7F)
 
-    uint16_t ip;
-#define INTIAL_PITCH_CENTER 0xE000
-#define INTIAL_PITCH_OCTAVE 0x1000
-
     union {
         uint16_t ifatn;
         struct {
@@ -314,39 +352,6 @@ typedef struct emu8k_voice_t {
         };
     };
 
-    int env_engine_on;
-
-    emu8k_mem_internal_t addr;
-    emu8k_mem_internal_t loop_start;
-    emu8k_mem_internal_t loop_end;
-
-    int32_t initial_att;
-    int32_t initial_filter;
-
-    emu8k_envelope_t vol_envelope;
-    emu8k_envelope_t mod_envelope;
-
-    int64_t              lfo1_speed;
-    int64_t              lfo2_speed;
-    emu8k_mem_internal_t lfo1_count;
-    emu8k_mem_internal_t lfo2_count;
-    int32_t              lfo1_delay_samples;
-    int32_t              lfo2_delay_samples;
-    int                  vol_l;
-    int                  vol_r;
-
-    int16_t fixed_modenv_filter_height;
-    int16_t fixed_modenv_pitch_height;
-    int16_t fixed_lfo1_filt_mod;
-    int16_t fixed_lfo1_vibrato;
-    int16_t fixed_lfo1_tremolo;
-    int16_t fixed_lfo2_vibrato;
-
-    /* filter internal data. */
-    int     filterq_idx;
-    int32_t filt_att;
-    int64_t filt_buffer[5];
-
 } emu8k_voice_t;
 
 typedef struct emu8k_t {
@@ -119,6 +119,12 @@ struct _opl3_chip {
     uint32_t noise;
     int16_t  zeromod;
     int32_t  mixbuff[4];
+    /* Per-channel output masks (cha/chb/chc/chd) mirrored as flat arrays,
+       plus a staging buffer for the channel accumulators, so the mixing
+       loops can run on SIMD lanes. Padded to a full lane multiple; the
+       padding masks stay zero. */
+    int16_t  chmask[4][24];
+    int16_t  chaccm[24];
     uint8_t  rm_hh_bit2;
     uint8_t  rm_hh_bit3;
     uint8_t  rm_hh_bit7;
@@ -42,8 +42,13 @@ typedef struct pc_timer_t {
     void (*callback)(void *priv);
     void *priv;
 
+    /* Intrusive pairing heap links: child points to the first child,
+       next to the following sibling, and prev to the previous sibling
+       (or to the parent for a first child). All three are NULL while
+       the timer is disabled. */
     struct pc_timer_t *prev;
     struct pc_timer_t *next;
+    struct pc_timer_t *child;
 } pc_timer_t;
 
 #ifdef __cplusplus
@@ -53,6 +53,19 @@ typedef union {
     uint8_t  b[8];
 } latch_t;
 
+/* Deferred scanline rendering: a captured display line (VRAM span plus the
+   parameters the renderer needs), converted to 32 bpp on a worker thread
+   before the frame is blitted. */
+#    define SVGA_DEFER_ENTRIES    1024
+#    define SVGA_DEFER_MAX_PIXELS 2080
+
+typedef struct svga_defer_line_t {
+    uint32_t *dst;
+    int       bpp;
+    int       pixels;
+    uint8_t   vram[SVGA_DEFER_MAX_PIXELS * 4];
+} svga_defer_line_t;
+
 typedef struct svga_t {
     mem_mapping_t mapping;
 
@@ -252,6 +265,18 @@ typedef struct svga_t {
     uint8_t *vram;
     uint8_t *changedvram;
 
+    /* Set while any changedvram entry or fullchange is live; svga_poll uses
+       it to flag frames whose blit can be skipped as unchanged. */
+    int frame_changed;
+    int blit_skippable;
+
+    /* Linear framebuffer pages currently promoted into the CPU's software
+       write TLB (logical page addresses).  They are evicted again at the end
+       of every frame, so the changedvram mark set at promotion time is never
+       staler than the writes it covers. */
+    uint32_t writelookup_pages[1024];
+    int      writelookup_count;
+
     uint8_t crtcreg;
     uint8_t gdcaddr;
     uint8_t attrff;
@@ -320,6 +345,15 @@ typedef struct svga_t {
     /* Return a 32 bpp color from a 15/16 bpp color. */
     uint32_t (*conv_16to32)(struct svga_t *svga, uint16_t color, uint8_t bpp);
 
+    /* Deferred scanline rendering (optional, see svga_deferred_render). */
+    svga_defer_line_t *defer_lines;
+    void              *defer_thread;
+    void              *defer_wake_event;
+    void              *defer_not_full_event;
+    volatile int       defer_read_idx;
+    volatile int       defer_write_idx;
+    volatile int       defer_thread_run;
+
     void *  dev8514;
     void *  ext8514;
     void *  clock_gen8514;
@@ -391,6 +425,9 @@ void     svga_writeb_linear(uint32_t addr, uint8_t val, void *priv);
 void     svga_writew_linear(uint32_t addr, uint16_t val, void *priv);
 void     svga_writel_linear(uint32_t addr, uint32_t val, void *priv);
 
+void svga_writelookup_add(svga_t *svga, uint32_t vram_addr);
+void svga_writelookup_flush(svga_t *svga);
+
 void svga_add_status_info(char *s, int max_len, void *priv);
 
 extern uint8_t svga_rotate[8][256];
@@ -417,6 +454,7 @@ enum {
 };
 
 uint32_t svga_lookup_lut_ram(svga_t* svga, uint32_t val);
+uint32_t svga_conv_16to32(svga_t *svga, uint16_t color, uint8_t bpp);
 
 /* We need a way to add a device with a pointer to a parent device so it can attach itself to it, and
    possibly also a second ATi 68860 RAM DAC type that auto-sets SVGA render on RAM DAC render change. */
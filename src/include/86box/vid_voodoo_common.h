@@ -97,6 +97,10 @@ enum {
 #define PARAM_MASK       (PARAM_SIZE - 1)
 #define PARAM_ENTRY_SIZE (1 << 31)
 
+/*Upper bound on the scanline-interleaved render threads. Must be a power of
+  two as thread selection uses odd_even_mask = render_threads - 1.*/
+#define RENDER_THREADS_MAX 8
+
 #define PARAM_ENTRIES(x) (voodoo->params_write_idx - voodoo->params_read_idx[x])
 #define PARAM_FULL(x)    ((voodoo->params_write_idx - voodoo->params_read_idx[x]) >= PARAM_SIZE)
 #define PARAM_EMPTY(x)   (voodoo->params_read_idx[x] == voodoo->params_write_idx)
@@ -233,7 +237,7 @@ typedef struct texture_t {
     uint32_t   base;
     uint32_t   tLOD;
     ATOMIC_INT refcount;
-    ATOMIC_INT refcount_r[4];
+    ATOMIC_INT refcount_r[RENDER_THREADS_MAX];
     int        is16;
     uint32_t   palette_checksum;
     uint32_t   addr_start[4];
@@ -361,27 +365,27 @@ typedef struct voodoo_t {
     int    ncc_dirty[2];
 
     thread_t *fifo_thread;
-    thread_t *render_thread[4];
+    thread_t *render_thread[RENDER_THREADS_MAX];
     event_t  *wake_fifo_thread;
     event_t  *wake_main_thread;
     event_t  *fifo_not_full_event;
     event_t  *fifo_empty_event;
     ATOMIC_INT fifo_empty_signaled;
-    event_t  *render_not_full_event[4];
-    event_t  *wake_render_thread[4];
+    event_t  *render_not_full_event[RENDER_THREADS_MAX];
+    event_t  *wake_render_thread[RENDER_THREADS_MAX];
 
     int voodoo_busy;
-    int render_voodoo_busy[4];
+    int render_voodoo_busy[RENDER_THREADS_MAX];
 
     int render_threads;
     int odd_even_mask;
 
-    int pixel_count[4];
-    int texel_count[4];
+    int pixel_count[RENDER_THREADS_MAX];
+    int texel_count[RENDER_THREADS_MAX];
     int tri_count;
     int frame_count;
-    int pixel_count_old[4];
-    int texel_count_old[4];
+    int pixel_count_old[RENDER_THREADS_MAX];
+    int texel_count_old[RENDER_THREADS_MAX];
     int wr_count;
     int rd_count;
     int tex_count;
@@ -414,7 +418,7 @@ typedef struct voodoo_t {
     ATOMIC_INT   pending_draw_cmds_buf[VOODOO_BUF_COUNT];
 
     voodoo_params_t params_buffer[PARAM_SIZE];
-    ATOMIC_INT      params_read_idx[4];
+    ATOMIC_INT      params_read_idx[RENDER_THREADS_MAX];
     ATOMIC_INT      params_write_idx;
 
     uint32_t   cmdfifo_base;
@@ -430,6 +434,12 @@ typedef struct voodoo_t {
     uint32_t   cmdfifo_amin;
     uint32_t   cmdfifo_amax;
     int        cmdfifo_holecount;
+    /*Prefetch buffer for AGP command stream fetches; owned by the FIFO
+      thread, see cmdfifo_agp_readl() in vid_voodoo_fifo.c.*/
+    uint32_t   cmdfifo_prefetch[16];
+    uint32_t   cmdfifo_prefetch_addr;
+    int        cmdfifo_prefetch_pos;
+    int        cmdfifo_prefetch_len;
 
     uint32_t   cmdfifo_base_2;
     uint32_t   cmdfifo_end_2;
@@ -444,6 +454,10 @@ typedef struct voodoo_t {
     uint32_t   cmdfifo_amin_2;
     uint32_t   cmdfifo_amax_2;
     int        cmdfifo_holecount_2;
+    uint32_t   cmdfifo_prefetch_2[16];
+    uint32_t   cmdfifo_prefetch_addr_2;
+    int        cmdfifo_prefetch_pos_2;
+    int        cmdfifo_prefetch_len_2;
 
     ATOMIC_UINT cmd_status, cmd_status_2;
 
@@ -675,7 +689,7 @@ typedef struct voodoo_t {
     int      palette_dirty[2];
 
     uint64_t time;
-    int      render_time[4];
+    int      render_time[RENDER_THREADS_MAX];
     uint64_t fifo_full_waits;
     uint64_t fifo_full_wait_ticks;
     uint64_t fifo_full_spin_checks;
@@ -715,7 +729,7 @@ typedef struct voodoo_t {
     uint32_t launch_pending;
 
     uint8_t fifo_thread_run;
-    uint8_t render_thread_run[4];
+    uint8_t render_thread_run[RENDER_THREADS_MAX];
 
     uint8_t *vram;
     uint8_t *changedvram;
@@ -231,6 +231,7 @@ extern uint32_t    *video_8to32;
 extern uint32_t    *video_15to32;
 extern uint32_t    *video_16to32;
 extern int          enable_overscan;
+extern int          svga_deferred_render;
 extern int          force_43;
 extern int          vid_resize;
 extern int          herc_blend;
@@ -0,0 +1,143 @@
+/*
+ * 86Box    A hypervisor and IBM PC system emulator that specializes in
+ *          running old operating systems and software designed for IBM
+ *          PC systems and compatibles from 1981 through fairly recent
+ *          system designs based on the PCI bus.
+ *
+ *          This file is part of the 86Box distribution.
+ *
+ *          Binary instruction trace sink.
+ *
+ *          Records are written by the emulator thread only, into a ring
+ *          mapped from a regular file, so an external tool can drain it
+ *          while the emulator runs; see instrtrace.h for the layout and
+ *          the environment variables that configure it. Unlike the
+ *          printf-class ENABLE_386_LOG paths, a record costs a handful
+ *          of stores, which keeps full-speed dynarec-vs-interpreter
+ *          stream diffs practical.
+ *
+ * Authors: Miran Grca, <mgrca8@gmail.com>
+ *
+ *          Copyright 2026 Miran Grca.
+ */
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <86box/86box.h>
+#include <86box/plat.h>
+#include <86box/instrtrace.h>
+
+#define INSTRTRACE_DEF_RECS (1 << 22)
+
+int instrtrace_on = -1;
+
+static FILE             *instrtrace_file = NULL;
+static instrtrace_hdr_t *instrtrace_hdr  = NULL;
+static instrtrace_rec_t *instrtrace_ring = NULL;
+static uint64_t          instrtrace_size = 0;
+static uint32_t          instrtrace_mask = 0;
+static uint32_t          instrtrace_cs_min = 0x0000;
+static uint32_t          instrtrace_cs_max = 0xffff;
+
+static void
+instrtrace_close(void)
+{
+    if (instrtrace_hdr != NULL) {
+        plat_munmap_file(instrtrace_hdr, instrtrace_size);
+        instrtrace_hdr  = NULL;
+        instrtrace_ring = NULL;
+    }
+    if (instrtrace_file != NULL) {
+        fclose(instrtrace_file);
+        instrtrace_file = NULL;
+    }
+    instrtrace_on = 0;
+}
+
+static void
+instrtrace_init(void)
+{
+    const char *path = getenv("INSTRTRACE_FILE");
+    const char *var;
+    uint32_t    recs = INSTRTRACE_DEF_RECS;
+
+    instrtrace_on = 0;
+
+    if (path == NULL)
+        return;
+
+    var = getenv("INSTRTRACE_RECS");
+    if (var != NULL) {
+        recs = (uint32_t) strtoul(var, NULL, 0);
+        if (recs < 1024)
+            recs = 1024;
+        /* Round up to a power of two so slot selection is a mask. */
+        while (recs & (recs - 1))
+            recs += recs & -recs;
+    }
+
+    var = getenv("INSTRTRACE_CS");
+    if (var != NULL)
+        sscanf(var, "%x-%x", &instrtrace_cs_min, &instrtrace_cs_max);
+
+    instrtrace_file = fopen(path, "wb+");
+    if (instrtrace_file == NULL)
+        return;
+
+    /* Size the file, then map it shared so the drain tool sees records
+       as they land. */
+    instrtrace_size = sizeof(instrtrace_hdr_t) + ((uint64_t) recs * sizeof(instrtrace_rec_t));
+    if (fseeko64(instrtrace_file, (off64_t) instrtrace_size - 1, SEEK_SET) ||
+        (fwrite("", 1, 1, instrtrace_file) != 1) || fflush(instrtrace_file)) {
+        instrtrace_close();
+        return;
+    }
+
+    instrtrace_hdr = (instrtrace_hdr_t *) plat_mmap_file(instrtrace_file, instrtrace_size);
+    if (instrtrace_hdr == NULL) {
+        instrtrace_close();
+        return;
+    }
+
+    instrtrace_hdr->magic     = INSTRTRACE_MAGIC;
+    instrtrace_hdr->version   = INSTRTRACE_VERSION;
+    instrtrace_hdr->rec_size  = sizeof(instrtrace_rec_t);
+    instrtrace_hdr->rec_count = recs;
+    instrtrace_hdr->write_idx = 0;
+
+    instrtrace_ring = (instrtrace_rec_t *) (instrtrace_hdr + 1);
+    instrtrace_mask = recs - 1;
+
+    atexit(instrtrace_close);
+    instrtrace_on = 1;
+}
+
+void
+instrtrace_record(uint16_t cs_sel, uint32_t eip, uint32_t fetchdat, uint32_t eflags, int type)
+{
+    instrtrace_rec_t *rec;
+
+    if (instrtrace_on < 0)
+        instrtrace_init();
+    if (!instrtrace_on)
+        return;
+
+    if ((cs_sel < instrtrace_cs_min) || (cs_sel > instrtrace_cs_max))
+        return;
+
+    rec = &instrtrace_ring[instrtrace_hdr->write_idx & instrtrace_mask];
+
+    rec->eip      = eip;
+    rec->fetchdat = fetchdat;
+    rec->cs_sel   = cs_sel;
+    rec->flags    = (uint16_t) eflags;
+    rec->eflags   = (uint16_t) (eflags >> 16);
+    rec->type     = (uint16_t) type;
+
+    /* The record must be visible before the index that publishes it. */
+    atomic_thread_fence(memory_order_release);
+    instrtrace_hdr->write_idx++;
+}
@@ -54,6 +54,18 @@ typedef struct {
     void     *priv;
 } io_trap_t;
 
+/* Dispatch is a flat table directly indexed by port number: one load of
+   io[port] reaches the handler chain, and a chain longer than one node only
+   exists where several devices genuinely claim the same port (ISA probing,
+   super I/O chips shadowing each other), in which case reads AND their
+   results together like the open-collector ISA bus.  Storing the first
+   handler inline in the table instead of behind the pointer was considered
+   and rejected: it saves a single dependent load in the common case, but
+   every word/dword access also has to rescan the chains of the neighbouring
+   ports for narrower handlers (an inw with no inl handler, an inb with
+   neither), so the six dispatch routines below and the removal path would
+   all grow inline/chain special cases for a load that is dwarfed by the
+   indirect call and the I/O cycle accounting. */
 int   initialized = 0;
 io_t *io[NPORTS];
 io_t *io_last[NPORTS];
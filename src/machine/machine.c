@@ -17,6 +17,7 @@
 #include <stdarg.h>
 #include <stdint.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <wchar.h>
 #define HAVE_STDARG_H
@@ -147,8 +148,24 @@ machine_init(void)
 int
 machine_available(int m)
 {
+    /* Availability boils down to which ROM files are on disk, which is
+       fixed for the lifetime of the process, but the probe itself stats
+       files and the settings dialog repeats it for every machine each
+       time a list is populated - so remember the verdicts. */
+    static int8_t  *avail_cache      = NULL;
+    static int      avail_cache_size = 0;
     int             ret = 0;
-    const device_t *dev = machine_get_device(m);
+    const device_t *dev;
+
+    if (avail_cache == NULL) {
+        avail_cache_size = machine_count();
+        avail_cache      = (int8_t *) calloc(avail_cache_size, sizeof(int8_t));
+    }
+
+    if ((m >= 0) && (m < avail_cache_size) && (avail_cache[m] != 0))
+        return avail_cache[m] - 1;
+
+    dev = machine_get_device(m);
 
     if (dev != NULL)
         ret = machine_device_available(dev);
@@ -166,6 +183,9 @@ machine_available(int m)
     } else if (ret == -2)
         ret = 0;
 
+    if ((m >= 0) && (m < avail_cache_size))
+        avail_cache[m] = (!!ret) + 1;
+
     return !!ret;
 }
 
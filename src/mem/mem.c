@@ -83,11 +83,11 @@ uint32_t pccache;
 uint8_t *pccache2;
 
 int        readlnext;
-int        readlookup[256];
+int        readlookup[MMU_CACHE_SIZE];
 uintptr_t  old_rl2;
 uint8_t    uncached = 0;
 int        writelnext;
-int        writelookup[256];
+int        writelookup[MMU_CACHE_SIZE];
 
 /* The lookup tables. */
 page_t *page_lookup[1048576] = { 0 };
@@ -101,7 +101,7 @@ int shadowbios = 0;
 int shadowbios_write;
 int readlnum  = 0;
 int writelnum = 0;
-int cachesize = 256;
+int cachesize = MMU_CACHE_SIZE;
 
 uint32_t get_phys_virt;
 uint32_t get_phys_phys;
@@ -174,7 +174,7 @@ resetreadlookup(void)
     memset(page_lookup, 0x00, (1 << 20) * sizeof(page_t *));
 
     /* Initialize the tables for lower (<= 1024K) RAM. */
-    for (uint16_t c = 0; c < 256; c++) {
+    for (uint16_t c = 0; c < cachesize; c++) {
         readlookup[c]  = 0xffffffff;
         writelookup[c] = 0xffffffff;
     }
@@ -188,12 +188,14 @@ resetreadlookup(void)
     writelnext = 0;
     pccache    = 0xffffffff;
     high_page  = 0;
+
+    flushmmucache_2386();
 }
 
 void
 flushmmucache(void)
 {
-    for (uint16_t c = 0; c < 256; c++) {
+    for (uint16_t c = 0; c < cachesize; c++) {
         if (readlookup[c] != (int) 0xffffffff) {
             readlookup2[readlookup[c]] = LOOKUP_INV;
             readlookup[c]              = 0xffffffff;
@@ -206,6 +208,8 @@ flushmmucache(void)
     }
     mmuflush++;
 
+    flushmmucache_2386();
+
     pccache  = (uint32_t) 0xffffffff;
     pccache2 = (uint8_t *) 0xffffffff;
 
@@ -217,7 +221,7 @@ flushmmucache(void)
 void
 flushmmucache_write(void)
 {
-    for (uint16_t c = 0; c < 256; c++) {
+    for (uint16_t c = 0; c < cachesize; c++) {
         if (writelookup[c] != (int) 0xffffffff) {
             page_lookup[writelookup[c]]  = NULL;
             writelookup2[writelookup[c]] = LOOKUP_INV;
@@ -225,6 +229,8 @@ flushmmucache_write(void)
         }
     }
     mmuflush++;
+
+    flushmmucache_2386();
 }
 
 void
@@ -243,7 +249,7 @@ flushmmucache_pc(void)
 void
 flushmmucache_nopc(void)
 {
-    for (uint16_t c = 0; c < 256; c++) {
+    for (uint16_t c = 0; c < cachesize; c++) {
         if (readlookup[c] != (int) 0xffffffff) {
             readlookup2[readlookup[c]] = LOOKUP_INV;
             readlookup[c]              = 0xffffffff;
@@ -254,6 +260,8 @@ flushmmucache_nopc(void)
             writelookup[c]               = 0xffffffff;
         }
     }
+
+    flushmmucache_2386();
 }
 
 void
@@ -261,7 +269,7 @@ mem_flush_write_page(uint32_t addr, uint32_t virt)
 {
     const page_t *page_target = &pages[addr >> 12];
 
-    for (uint16_t c = 0; c < 256; c++) {
+    for (uint16_t c = 0; c < cachesize; c++) {
         if (writelookup[c] != (int) 0xffffffff) {
             uintptr_t target = (uintptr_t) &ram[(uintptr_t) (addr & ~0xfff) - (virt & ~0xfff)];
             if (writelookup2[writelookup[c]] == target || page_lookup[writelookup[c]] == page_target) {
@@ -630,6 +638,45 @@ addwritelookup(uint32_t virt, uint32_t phys)
     cycles -= 9;
 }
 
+/* Promote a page backed by plain video memory (or any other external memory
+   with no write side effects) into the software write TLB, so that the
+   interpreter and the dynarec store to the backing array directly.  The
+   caller is responsible for dirty tracking and must evict the page again
+   with removewritelookup() no later than when the backing mapping changes
+   behavior.  Code can never execute from such pages (they have no exec
+   pointer), so no codeblock invalidation is needed. */
+void
+addwritelookup_vram(uint32_t virt, uint8_t *mem)
+{
+    if (virt == 0xffffffff)
+        return;
+
+    if (page_lookup[virt >> 12] || (writelookup2[virt >> 12] != (uintptr_t) LOOKUP_INV))
+        return;
+
+    if (writelookup[writelnext] != -1) {
+        page_lookup[writelookup[writelnext]]  = NULL;
+        writelookup2[writelookup[writelnext]] = LOOKUP_INV;
+    }
+
+    writelookup2[virt >> 12] = (uintptr_t) mem - (uintptr_t) (virt & ~0xfff);
+
+    writelookup[writelnext++] = virt >> 12;
+    writelnext &= (cachesize - 1);
+
+    cycles -= 9;
+}
+
+/* Evict a single page from the software write TLB.  The ring slot is left
+   as-is; when it comes around again it merely re-invalidates the page, so
+   evicting a page that has already been recycled is harmless. */
+void
+removewritelookup(uint32_t virt)
+{
+    page_lookup[virt >> 12]  = NULL;
+    writelookup2[virt >> 12] = LOOKUP_INV;
+}
+
 uint8_t *
 getpccache(uint32_t a)
 {
@@ -756,6 +803,11 @@ readmembl(uint32_t addr)
 
     high_page = 0;
 
+    /* Fast path - page is in the software TLB, read straight from the host
+       pointer as the inline macros in 386_common.h do. */
+    if (readlookup2[addr >> 12] != (uintptr_t) LOOKUP_INV)
+        return *(uint8_t *) (readlookup2[addr >> 12] + addr);
+
     if (cr0 >> 31) {
         a      = mmutranslate_read(addr);
         addr64 = (uint32_t) a;
@@ -793,6 +845,12 @@ writemembl(uint32_t addr, uint8_t val)
         return;
     }
 
+    /* Fast path - page is in the software TLB and has no codeblocks. */
+    if (writelookup2[addr >> 12] != (uintptr_t) LOOKUP_INV) {
+        *(uint8_t *) (writelookup2[addr >> 12] + addr) = val;
+        return;
+    }
+
     if (cr0 >> 31) {
         a      = mmutranslate_write(addr);
         addr64 = (uint32_t) a;
@@ -895,7 +953,8 @@ readmemwl(uint32_t addr)
             return readmembl_no_mmut(addr, addr64a[0]) | (((uint16_t) readmembl_no_mmut(addr + 1, addr64a[1])) << 8);
         } else if (readlookup2[addr >> 12] != (uintptr_t) LOOKUP_INV)
             return *(uint16_t *) (readlookup2[addr >> 12] + addr);
-    }
+    } else if (readlookup2[addr >> 12] != (uintptr_t) LOOKUP_INV)
+        return *(uint16_t *) (readlookup2[addr >> 12] + addr);
 
     if (cr0 >> 31) {
         a          = mmutranslate_read(addr);
@@ -965,6 +1024,9 @@ writememwl(uint32_t addr, uint16_t val)
             *(uint16_t *) (writelookup2[addr >> 12] + addr) = val;
             return;
         }
+    } else if (writelookup2[addr >> 12] != (uintptr_t) LOOKUP_INV) {
+        *(uint16_t *) (writelookup2[addr >> 12] + addr) = val;
+        return;
     }
 
     if (page_lookup[addr >> 12] && page_lookup[addr >> 12]->write_w) {
@@ -1145,7 +1207,8 @@ readmemll(uint32_t addr)
             return readmemwl_no_mmut(addr, addr64a) | (((uint32_t) readmemwl_no_mmut(addr + 2, &(addr64a[2]))) << 16);
         } else if (readlookup2[addr >> 12] != (uintptr_t) LOOKUP_INV)
             return *(uint32_t *) (readlookup2[addr >> 12] + addr);
-    }
+    } else if (readlookup2[addr >> 12] != (uintptr_t) LOOKUP_INV)
+        return *(uint32_t *) (readlookup2[addr >> 12] + addr);
 
     if (cr0 >> 31) {
         a          = mmutranslate_read(addr);
@@ -1229,6 +1292,9 @@ writememll(uint32_t addr, uint32_t val)
             *(uint32_t *) (writelookup2[addr >> 12] + addr) = val;
             return;
         }
+    } else if (writelookup2[addr >> 12] != (uintptr_t) LOOKUP_INV) {
+        *(uint32_t *) (writelookup2[addr >> 12] + addr) = val;
+        return;
     }
 
     if (page_lookup[addr >> 12] && page_lookup[addr >> 12]->write_l) {
@@ -1761,6 +1827,66 @@ mem_write_phys(void *src, uint32_t addr, int transfer_size)
     }
 }
 
+/* Bulk versions of the above for bus master block transfers: the mapping is
+   constant within each granularity block, so it is looked up once and the
+   whole span within the block is moved with a single memcpy when the mapping
+   is backed by host memory. I/O-handled mappings fall back to the per-unit
+   accessors so device read/write handlers still see the programmed transfer
+   size. The length must be a multiple of the transfer size. */
+void
+mem_read_phys_bulk(void *dest, uint32_t addr, uint32_t len, int transfer_size)
+{
+    uint8_t *p = (uint8_t *) dest;
+
+    mem_logical_addr = 0xffffffff;
+
+    while (len > 0) {
+        const mem_mapping_t *map   = read_mapping_bus[addr >> MEM_GRANULARITY_BITS];
+        uint32_t             block = MEM_GRANULARITY_SIZE - (addr & MEM_GRANULARITY_MASK);
+
+        if (block > len)
+            block = len;
+
+        if (cpu_use_exec && map && map->exec)
+            memcpy(p, &(map->exec[(addr - map->base) & map->mask]), block);
+        else {
+            mem_read_phys((void *) p, addr, transfer_size);
+            block = transfer_size;
+        }
+
+        p += block;
+        addr += block;
+        len -= block;
+    }
+}
+
+void
+mem_write_phys_bulk(const void *src, uint32_t addr, uint32_t len, int transfer_size)
+{
+    const uint8_t *p = (const uint8_t *) src;
+
+    mem_logical_addr = 0xffffffff;
+
+    while (len > 0) {
+        const mem_mapping_t *map   = write_mapping_bus[addr >> MEM_GRANULARITY_BITS];
+        uint32_t             block = MEM_GRANULARITY_SIZE - (addr & MEM_GRANULARITY_MASK);
+
+        if (block > len)
+            block = len;
+
+        if (cpu_use_exec && map && map->exec)
+            memcpy(&(map->exec[(addr - map->base) & map->mask]), p, block);
+        else {
+            mem_write_phys((void *) p, addr, transfer_size);
+            block = transfer_size;
+        }
+
+        p += block;
+        addr += block;
+        len -= block;
+    }
+}
+
 uint8_t
 mem_read_ram(uint32_t addr, UNUSED(void *priv))
 {
@@ -2731,7 +2857,7 @@ mem_init_ram_mapping(mem_mapping_t *mapping, uint32_t base, uint32_t size)
 void
 mem_zero(void)
 {
-    memset(ram, 0x00, ram_size + 16);
+    plat_mmap_zero(ram, ram_size + 16);
 }
 
 /* Reset the memory state. */
@@ -2770,12 +2896,16 @@ mem_reset(void)
 
     ram_size = m;
     /* Allocate 16 extra bytes of RAM to mitigate some dynarec recompiler memory access quirks. */
-    ram      = (uint8_t *) plat_mmap(ram_size + 16, 0); /* allocate and clear the RAM block */
+    ram      = (uint8_t *) plat_mmap(ram_size + 16, 0); /* allocate the RAM block */
     if (ram == NULL) {
         fatal("Failed to allocate RAM block. Make sure you have enough RAM available.\n");
         return;
     }
-    memset(ram, 0x00, ram_size + 16);
+    /*
+       No clearing needed: plat_mmap() mappings (anonymous mmap or
+       VirtualAlloc MEM_COMMIT) are zero on first touch, and not touching
+       them here keeps untouched guest RAM uncommitted on the host.
+     */
 
     /*
      * Allocate the page table based on how much RAM we have.
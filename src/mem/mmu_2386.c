@@ -171,6 +171,36 @@ mem_writel_map(uint32_t addr, uint32_t val)
 #define mmutranslate_read_2386(addr) mmutranslatereal_2386(addr,0)
 #define mmutranslate_write_2386(addr) mmutranslatereal_2386(addr,1)
 
+/* The 286/386 core does not feed the readlookup2/writelookup2 arrays (those
+   are only populated from the RAM accessors when cpu_use_exec is set), so
+   without further caching every paged access would walk the page tables
+   through emulated memory reads. Keep a small direct-mapped translation
+   cache here instead, split by access type the same way the lookup arrays
+   are, so a write is only served from an entry whose walk has already set
+   the dirty bit. Entries store the combined U/S and R/W bits of both table
+   levels and the privilege check is redone on every hit, since CPL can
+   change without any architectural TLB flush; a hit that now lacks
+   permission falls back to the full walk so the fault is raised with the
+   proper error code. The cache is flushed alongside the lookup arrays from
+   the flushmmucache* family, preserving the architectural contract that
+   CR3 loads and INVLPG discard stale translations. */
+#define MMU_2386_TLB_SIZE 256
+#define MMU_2386_TLB_MASK (MMU_2386_TLB_SIZE - 1)
+
+typedef struct mmu_2386_tlb_entry_t {
+    uint32_t vpage; /* Virtual page number, 0xffffffff = invalid. */
+    uint32_t ppage; /* Physical page base. */
+    uint32_t attrs; /* Combined (ANDed) attribute bits of PDE and PTE. */
+} mmu_2386_tlb_entry_t;
+
+static mmu_2386_tlb_entry_t mmu_2386_tlb[2][MMU_2386_TLB_SIZE];
+
+void
+flushmmucache_2386(void)
+{
+    memset(mmu_2386_tlb, 0xff, sizeof(mmu_2386_tlb));
+}
+
 uint64_t
 mmutranslatereal_2386(uint32_t addr, int rw)
 {
@@ -178,10 +208,19 @@ mmutranslatereal_2386(uint32_t addr, int rw)
     uint32_t temp2;
     uint32_t temp3;
     uint32_t addr2;
+    uint32_t vpage = addr >> 12;
+
+    mmu_2386_tlb_entry_t *ent = &mmu_2386_tlb[!!rw][vpage & MMU_2386_TLB_MASK];
 
     if (cpu_state.abrt)
         return 0xffffffffffffffffULL;
 
+    if (ent->vpage == vpage) {
+        temp3 = ent->attrs;
+        if (!(((CPL == 3) && !(temp3 & 4) && !cpl_override) || (rw && !cpl_override && !(temp3 & 2) && (((CPL == 3) && !cpl_override) || ((is486 || isibm486) && (cr0 & WP_FLAG))))))
+            return (uint64_t) (ent->ppage | (addr & 0xfff));
+    }
+
     addr2 = ((cr3 & ~0xfff) + ((addr >> 20) & 0xffc));
     temp = temp2 = mem_readl_map(addr2);
     if (!(temp & 1)) {
@@ -213,6 +252,10 @@ mmutranslatereal_2386(uint32_t addr, int rw)
 
         mem_writel_map(addr2, mem_readl_map(addr2) | (rw ? 0x60 : 0x20));
 
+        ent->vpage = vpage;
+        ent->ppage = (temp & ~0x3fffff) + (addr & 0x3ff000);
+        ent->attrs = temp;
+
         return (temp & ~0x3fffff) + (addr & 0x3fffff);
     }
 
@@ -234,6 +277,10 @@ mmutranslatereal_2386(uint32_t addr, int rw)
     mem_writel_map((temp2 & ~0xfff) + ((addr >> 10) & 0xffc),
                    mem_readl_map((temp2 & ~0xfff) + ((addr >> 10) & 0xffc)) | (rw ? 0x60 : 0x20));
 
+    ent->vpage = vpage;
+    ent->ppage = temp & ~0xfff;
+    ent->attrs = temp3;
+
     return (uint64_t) ((temp & ~0xfff) + (addr & 0xfff));
 }
 
@@ -32,6 +32,7 @@
 #include <86box/device.h>
 #include <86box/timer.h>
 #include <86box/nvr.h>
+#include <86box/plat.h>
 #include <86box/log.h>
 #include <86box/nmc93cxx.h>
 #include <86box/plat_unused.h>
@@ -660,10 +661,23 @@ static void
 nmc93cxx_eeprom_close(void *priv)
 {
     nmc93cxx_eeprom_t *dev = priv;
-    FILE              *fp  = nvr_fopen(dev->filename, "wb");
+    char               temp_fn[sizeof(dev->filename) + 4];
+    char               path[1024];
+    char               temp_path[1024];
+
+    /*
+       Write to a temporary file and rename it over the old one, so that
+       a crash mid-write never leaves a truncated EEPROM file.
+     */
+    snprintf(temp_fn, sizeof(temp_fn), "%s.tmp", dev->filename);
+    FILE *fp = nvr_fopen(temp_fn, "wb");
     if (fp) {
         fwrite(dev->array_data, dev->data_bits / 8, dev->cells, fp);
         fclose(fp);
+        /* nvr_path() returns a static buffer, so copy between calls. */
+        snprintf(temp_path, sizeof(temp_path), "%s", nvr_path(temp_fn));
+        snprintf(path, sizeof(path), "%s", nvr_path(dev->filename));
+        plat_rename(temp_path, path);
     }
     log_close(dev->log);
     free(dev);
@@ -280,28 +280,56 @@ asset_getfile(const char *fn, char *s, int size)
     }
 }
 
+/* Availability scans (machine list at startup, device_available callbacks
+   every time the settings dialog opens) probe the same file names against
+   every ROM path over and over, which is painful when the ROM set sits on
+   network storage. The ROM set does not change while we are running, so
+   remember each verdict for the life of the process. */
+typedef struct rom_present_ent_t {
+    char                      *fn;
+    int                        present;
+    struct rom_present_ent_t  *next;
+} rom_present_ent_t;
+
+static rom_present_ent_t *rom_present_cache = NULL;
+
 int
 rom_present(const char *fn)
 {
-    char temp[1024];
+    char               temp[1024];
+    rom_present_ent_t *ent;
+    int                present = 0;
 
     if (fn == NULL)
         return 0;
 
+    for (ent = rom_present_cache; ent != NULL; ent = ent->next) {
+        if (!strcmp(ent->fn, fn))
+            return ent->present;
+    }
+
     if (!strncmp(fn, "roms/", 5)) {
         /* Relative path */
         for (rom_path_t *rom_path = &rom_paths; rom_path != NULL; rom_path = rom_path->next) {
             path_append_filename(temp, rom_path->path, fn + 5);
 
-            if (plat_file_check(temp))
-                return 1;
+            if (plat_file_check(temp)) {
+                present = 1;
+                break;
+            }
         }
-
-        return 0;
     } else {
         /* Absolute path */
-        return plat_file_check(fn);
+        present = plat_file_check(fn);
     }
+
+    ent = malloc(sizeof(rom_present_ent_t));
+    ent->fn           = strdup(fn);
+    ent->present      = present;
+    ent->next         = rom_present_cache;
+    rom_present_cache = ent;
+
+    return present;
 }
 
 int
@@ -430,6 +458,14 @@ rom_writel(uint32_t addr, uint32_t val, void *priv)
     *(uint32_t *) &rom->rom[(addr - rom->mapping.base) & rom->mask] = val;
 }
 
+/* The loaders below deliberately copy into the caller's buffer instead
+   of memory-mapping the image file (as hdd_image.c does through
+   plat_mmap_file()): a BIOS area is composed from several chip images
+   at arbitrary, non-page-aligned offsets, several load modes transform
+   the bytes on the way in (interleaving, inversion, odd/even), and
+   flash devices write to the result.  The copies are at most a few
+   megabytes per machine and the OS page cache already shares the
+   underlying file reads between instances. */
 int
 rom_load_linear_oddeven(const char *fn, uint32_t addr, int sz, int off, uint8_t *ptr)
 {
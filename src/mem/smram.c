@@ -142,7 +142,17 @@ smram_backup_all(void)
     }
 }
 
-/* Recalculate any mappings, including the backup if returning from SMM. */
+/* Recalculate any mappings, including the backup if returning from SMM.
+   This runs on every SMI entry and exit. Prebuilding the SMM and non-SMM
+   lookup states and toggling between them was looked at and does not pay:
+   the per-granule rebuild below only touches the SMRAM ranges themselves
+   (a handful of 16k granules) and skips non-overlapping mappings cheaply,
+   while a second view would have to duplicate all five flat lookup tables
+   and be rebuilt on every chipset register write that changes either view.
+   The dominant cost is the flushmmucache() at the end, and that one is not
+   avoidable by a pointer swap: the MMU lookup caches hold virtual-to-host
+   pointers that are stale in the other world regardless of how quickly the
+   physical tables switch. */
 void
 smram_recalc_all(int ret)
 {
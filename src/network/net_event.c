@@ -2,14 +2,18 @@
 #    define WIN32_LEAN_AND_MEAN
 #    include <windows.h>
 #else
+#    include <stdint.h>
 #    include <unistd.h>
 #    include <fcntl.h>
+#    ifdef __linux__
+#        include <sys/eventfd.h>
+#    endif
 #endif
 
 #include <86box/net_event.h>
 #include <86box/plat_unused.h>
 
-#ifndef _WIN32
+#if !defined(_WIN32) && !defined(__linux__)
 static void
 setup_fd(int fd)
 {
@@ -23,6 +27,12 @@ net_event_init(net_evt_t *event)
 {
 #ifdef _WIN32
     event->handle = CreateEvent(NULL, FALSE, FALSE, NULL);
+#elif defined(__linux__)
+    /*
+       An eventfd is both ends at once: a single wakeup fd that a reader
+       drains in one syscall, no matter how many times it was signalled.
+     */
+    event->fds[0] = event->fds[1] = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
 #else
     (void) !pipe(event->fds);
     setup_fd(event->fds[0]);
@@ -35,6 +45,9 @@ net_event_set(net_evt_t *event)
 {
 #ifdef _WIN32
     SetEvent(event->handle);
+#elif defined(__linux__)
+    uint64_t one = 1;
+    (void) !write(event->fds[1], &one, sizeof(one));
 #else
     (void) !write(event->fds[1], "a", 1);
 #endif
@@ -45,6 +58,10 @@ net_event_clear(UNUSED(net_evt_t *event))
 {
 #ifdef _WIN32
     /* Do nothing on WIN32 since we use an auto-reset event */
+#elif defined(__linux__)
+    /* One read resets the counter, however often the event was set. */
+    uint64_t count;
+    (void) !read(event->fds[0], &count, sizeof(count));
 #else
     char dummy[1];
     (void) !read(event->fds[0], &dummy, sizeof(dummy));
@@ -56,6 +73,8 @@ net_event_close(net_evt_t *event)
 {
 #ifdef _WIN32
     CloseHandle(event->handle);
+#elif defined(__linux__)
+    close(event->fds[0]);
 #else
     close(event->fds[0]);
     close(event->fds[1]);
@@ -165,9 +165,9 @@ net_null_init(const netcard_t *card, const uint8_t *mac_addr, UNUSED(void *priv)
     memcpy(net_null->mac_addr, mac_addr, sizeof(net_null->mac_addr));
 
     for (int i = 0; i < NULL_PKT_BATCH; i++) {
-        net_null->pktv[i].data = calloc(1, NET_MAX_FRAME);
+        net_null->pktv[i].data = network_bufpool_get();
     }
-    net_null->pkt.data = calloc(1, NET_MAX_FRAME);
+    net_null->pkt.data = network_bufpool_get();
 
     net_event_init(&net_null->tx_event);
     net_event_init(&net_null->stop_event);
@@ -204,9 +204,9 @@ net_null_close(void *priv)
     net_null_log("Null Network: thread ended\n");
 
     for (int i = 0; i < NULL_PKT_BATCH; i++) {
-        free(net_null->pktv[i].data);
+        network_bufpool_put(net_null->pktv[i].data);
     }
-    free(net_null->pkt.data);
+    network_bufpool_put(net_null->pkt.data);
 
     net_event_close(&net_null->tx_event);
     net_event_close(&net_null->stop_event);
@@ -70,6 +70,10 @@
 
 #define PCAP_PKT_BATCH NET_QUEUE_LEN
 
+/* Kernel capture buffer size. A larger ring lets busy segments be
+   delivered in bursts instead of waking us per frame. */
+#define PCAP_BUFFER_SIZE (2 * 1024 * 1024)
+
 enum {
     NET_EVENT_STOP = 0,
     NET_EVENT_TX,
@@ -164,7 +168,8 @@ static const unsigned char
 static int (*f_pcap_sendpacket)(void *, const unsigned char *, int);
 static void (*f_pcap_close)(void *);
 static int (*f_pcap_setnonblock)(void *, int, char *);
-static int (*f_pcap_set_immediate_mode)(void *, int);
+static int (*f_pcap_set_timeout)(void *, int);
+static int (*f_pcap_set_buffer_size)(void *, int);
 static int (*f_pcap_set_promisc)(void *, int);
 static int (*f_pcap_set_snaplen)(void *, int);
 static int (*f_pcap_dispatch)(void *, int, pcap_handler callback, unsigned char *user);
@@ -192,7 +197,8 @@ static dllimp_t pcap_imports[] = {
     { "pcap_sendpacket",         &f_pcap_sendpacket        },
     { "pcap_close",              &f_pcap_close             },
     { "pcap_setnonblock",        &f_pcap_setnonblock       },
-    { "pcap_set_immediate_mode", &f_pcap_set_immediate_mode},
+    { "pcap_set_timeout",        &f_pcap_set_timeout       },
+    { "pcap_set_buffer_size",    &f_pcap_set_buffer_size   },
     { "pcap_set_promisc",        &f_pcap_set_promisc       },
     { "pcap_set_snaplen",        &f_pcap_set_snaplen       },
     { "pcap_dispatch",           &f_pcap_dispatch          },
@@ -482,8 +488,14 @@ net_pcap_init(const netcard_t *card, const uint8_t *mac_addr, void *priv, char *
     if (f_pcap_setnonblock(pcap->pcap, 1, errbuf) != 0)
         pcap_log("PCAP: failed nonblock %s\n", errbuf);
 
-    if (f_pcap_set_immediate_mode(pcap->pcap, 1) != 0)
-        pcap_log("PCAP: error setting immediate mode\n");
+    /* Let the capture ring accumulate frames for up to 1 ms instead of
+       waking us per frame; libpcap services this from its mmap'd ring
+       (TPACKET_V3 on Linux), so bursts arrive in one dispatch. */
+    if (f_pcap_set_timeout(pcap->pcap, 1) != 0)
+        pcap_log("PCAP: error setting timeout\n");
+
+    if (f_pcap_set_buffer_size(pcap->pcap, PCAP_BUFFER_SIZE) != 0)
+        pcap_log("PCAP: error setting buffer size\n");
 
     if (f_pcap_set_promisc(pcap->pcap, 1) != 0)
         pcap_log("PCAP: error enabling promiscuous mode\n");
@@ -527,9 +539,9 @@ net_pcap_init(const netcard_t *card, const uint8_t *mac_addr, void *priv, char *
 #endif
 
     for (int i = 0; i < PCAP_PKT_BATCH; i++) {
-        pcap->pktv[i].data = calloc(1, NET_MAX_FRAME);
+        pcap->pktv[i].data = network_bufpool_get();
     }
-    pcap->pkt.data = calloc(1, NET_MAX_FRAME);
+    pcap->pkt.data = network_bufpool_get();
 
     net_event_init(&pcap->tx_event);
     net_event_init(&pcap->stop_event);
@@ -558,9 +570,9 @@ net_pcap_close(void *priv)
     pcap_log("PCAP: thread ended\n");
 
     for (int i = 0; i < PCAP_PKT_BATCH; i++) {
-        free(pcap->pktv[i].data);
+        network_bufpool_put(pcap->pktv[i].data);
     }
-    free(pcap->pkt.data);
+    network_bufpool_put(pcap->pkt.data);
 
 #ifdef _WIN32
     f_pcap_sendqueue_destroy((void *) pcap->pcap_queue);
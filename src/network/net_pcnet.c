@@ -262,6 +262,7 @@ typedef struct {
     int        transfer_size;
     uint8_t    maclocal[6]; /* configured MAC (local) address */
     pc_timer_t timer, timer_soft_int, timer_restore;
+    netcoal_t  coal;
     netcard_t *netcard;
 } nic_t;
 
@@ -925,6 +926,12 @@ pcnetUpdateIrq(nic_t *dev)
     dev->iISR = iISR;
 }
 
+static void
+pcnetCoalFire(void *priv)
+{
+    pcnetUpdateIrq((nic_t *) priv);
+}
+
 static void
 pcnetInit(nic_t *dev)
 {
@@ -1433,7 +1440,8 @@ pcnetReceiveNoSync(void *priv, uint8_t *buf, int size)
         }
     }
 
-    pcnetUpdateIrq(dev);
+    /* Coalesce the receive interrupt; CSR0 already reflects the frame. */
+    network_coal_defer(&dev->coal);
 
     return 1;
 }
@@ -3060,6 +3068,8 @@ pcnet_init(const device_t *info)
     dev->netcard              = network_attach(dev, dev->aPROM, pcnetReceiveNoSync, pcnetSetLinkState);
     dev->netcard->byte_period = (dev->board == DEV_AM79C973) ? NET_PERIOD_100M : NET_PERIOD_10M;
 
+    network_coal_init(&dev->coal, pcnetCoalFire, dev);
+
     timer_add(&dev->timer, pcnetPollTimer, dev, 0);
 
     if (dev->board == DEV_AM79C973)
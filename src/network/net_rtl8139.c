@@ -462,6 +462,9 @@ struct RTL8139State {
     /* PCI interrupt timer */
     pc_timer_t timer;
 
+    /* receive interrupt coalescing */
+    netcoal_t coal;
+
     mem_mapping_t bar_mem;
 
     /* Support migration to/from old versions */
@@ -491,6 +494,12 @@ rtl8139_update_irq(RTL8139State *s)
         pci_clear_irq(d, PCI_INTA, &s->irq_state);
 }
 
+static void
+rtl8139_coal_fire(void *priv)
+{
+    rtl8139_update_irq((RTL8139State *) priv);
+}
+
 static int
 rtl8139_RxWrap(RTL8139State *s)
 {
@@ -999,9 +1008,9 @@ rtl8139_do_receive(void *priv, uint8_t *buf, int size_)
 
     s->IntrStatus |= RxOK;
 
-    {
-        rtl8139_update_irq(s);
-    }
+    /* Coalesce the good-receive interrupt; overflow/error paths above still
+       assert immediately. */
+    network_coal_defer(&s->coal);
 
     return size_;
 }
@@ -3293,6 +3302,7 @@ nic_init(const device_t *info)
     s->eeprom = device_add_inst_params(&nmc93cxx_device, s->inst, &params);
 
     s->nic = network_attach(s, (uint8_t *) &s->phys[MAC0], rtl8139_do_receive, rtl8139_set_link_status);
+    network_coal_init(&s->coal, rtl8139_coal_fire, s);
     timer_add(&s->timer, rtl8139_timer, s, 0);
     timer_on_auto(&s->timer, 1000000.0 / cpu_pci_speed);
 
@@ -597,9 +597,9 @@ net_slirp_init(const netcard_t *card, const uint8_t *mac_addr, UNUSED(void *priv
     }
 
     for (int i = 0; i < SLIRP_PKT_BATCH; i++) {
-        slirp->pkt_tx_v[i].data = calloc(1, NET_MAX_FRAME);
+        slirp->pkt_tx_v[i].data = network_bufpool_get();
     }
-    slirp->pkt.data = calloc(1, NET_MAX_FRAME);
+    slirp->pkt.data = network_bufpool_get();
     net_event_init(&slirp->rx_event);
     net_event_init(&slirp->tx_event);
     net_event_init(&slirp->stop_event);
@@ -660,9 +660,9 @@ net_slirp_close(void *priv)
     net_event_close(&slirp->rx_event);
     slirp_cleanup(slirp->slirp);
     for (int i = 0; i < SLIRP_PKT_BATCH; i++) {
-        free(slirp->pkt_tx_v[i].data);
+        network_bufpool_put(slirp->pkt_tx_v[i].data);
     }
-    free(slirp->pkt.data);
+    network_bufpool_put(slirp->pkt.data);
     free(slirp);
 }
 
@@ -388,35 +388,43 @@ net_switch_thread(void *priv)
             packets = network_tx_popv(netswitch->card, netswitch->pkt_tx_v, SWITCH_PKT_BATCH);
             if (!(net_cards_conf[netswitch->card->card_num].link_state & NET_LINK_DOWN)) {
                 for (int i = 0; i < packets; i++) {
-                    int orig_len = netswitch->pkt_tx_v[i].len;
-                    int send_len = orig_len;
-                    uint8_t augmented[sizeof(netswitch->secret_hash) + NET_MAX_FRAME];
-                    if (netswitch->secret_enabled) {
-                        send_len = orig_len + sizeof(netswitch->secret_hash);
-
-                        /* Build header with secret hash */
-                        uint8_t *hdr = augmented;
-                        memcpy(hdr, netswitch->secret_hash, sizeof(netswitch->secret_hash));
-                        memcpy(augmented + sizeof(netswitch->secret_hash),
-                               netswitch->pkt_tx_v[i].data, orig_len);
-                    }
-
 #define MAC_FORMAT "(%02X:%02X:%02X:%02X:%02X:%02X -> %02X:%02X:%02X:%02X:%02X:%02X)"
-#define MAC_FORMAT_NOSECRET_ARGS(p) (p)[6], (p)[7], (p)[8], (p)[9], (p)[10], (p)[11], (p)[0], (p)[1], (p)[2], (p)[3], (p)[4], (p)[5]
-#define MAC_FORMAT_ARGS(p) (p)[38], (p)[39], (p)[40], (p)[41], (p)[42], (p)[43], (p)[32], (p)[33], (p)[34], (p)[35], (p)[36], (p)[37]
+#define MAC_FORMAT_ARGS(p) (p)[6], (p)[7], (p)[8], (p)[9], (p)[10], (p)[11], (p)[0], (p)[1], (p)[2], (p)[3], (p)[4], (p)[5]
                     netswitch_log("Network Switch: sending %d-byte packet " MAC_FORMAT "\n",
                                   netswitch->pkt_tx_v[i].len,
-                                  netswitch->secret_enabled ? MAC_FORMAT_ARGS(netswitch->pkt_tx_v[i].data)
-                                                            : MAC_FORMAT_NOSECRET_ARGS(netswitch->pkt_tx_v[i].data));
-
-                    /* Send through all known host interfaces. */
-                    for (net_switch_hostaddr_t *hostaddr = netswitch->hostaddrs; hostaddr; hostaddr = hostaddr->next)
-                        if (netswitch->secret_enabled)
-                            sendto(hostaddr->socket_tx, (char *)augmented, send_len, 0,
-                                   &hostaddr->addr_tx.sa, sizeof(hostaddr->addr_tx.sa));
-                        else
-                            sendto(hostaddr->socket_tx, (char *)netswitch->pkt_tx_v[i].data,
-                                   send_len, 0, &hostaddr->addr_tx.sa, sizeof(hostaddr->addr_tx.sa));
+                                  MAC_FORMAT_ARGS(netswitch->pkt_tx_v[i].data));
+
+                    /* Send through all known host interfaces. The secret hash is
+                       prepended with scatter-gather I/O instead of copying the
+                       frame into a staging buffer. */
+                    for (net_switch_hostaddr_t *hostaddr = netswitch->hostaddrs; hostaddr; hostaddr = hostaddr->next) {
+                        if (netswitch->secret_enabled) {
+#ifdef _WIN32
+                            WSABUF bufs[2] = {
+                                { .len = sizeof(netswitch->secret_hash), .buf = (char *) netswitch->secret_hash   },
+                                { .len = netswitch->pkt_tx_v[i].len,     .buf = (char *) netswitch->pkt_tx_v[i].data }
+                            };
+                            DWORD sent;
+                            WSASendTo(hostaddr->socket_tx, bufs, 2, &sent, 0,
+                                      &hostaddr->addr_tx.sa, sizeof(hostaddr->addr_tx.sa), NULL, NULL);
+#else
+                            struct iovec iov[2] = {
+                                { .iov_base = netswitch->secret_hash,      .iov_len = sizeof(netswitch->secret_hash) },
+                                { .iov_base = netswitch->pkt_tx_v[i].data, .iov_len = netswitch->pkt_tx_v[i].len     }
+                            };
+                            struct msghdr msg = {
+                                .msg_name    = &hostaddr->addr_tx.sa,
+                                .msg_namelen = sizeof(hostaddr->addr_tx.sa),
+                                .msg_iov     = iov,
+                                .msg_iovlen  = 2
+                            };
+                            sendmsg(hostaddr->socket_tx, &msg, 0);
+#endif
+                        } else {
+                            sendto(hostaddr->socket_tx, (char *) netswitch->pkt_tx_v[i].data,
+                                   netswitch->pkt_tx_v[i].len, 0, &hostaddr->addr_tx.sa, sizeof(hostaddr->addr_tx.sa));
+                        }
+                    }
                 }
             }
             netswitch->during_tx = 0;
@@ -440,22 +448,39 @@ net_switch_thread(void *priv)
         if (pfd[NET_EVENT_RX].revents & POLLIN) {
 #endif
             if (netswitch->secret_enabled) {
-                len = recv(netswitch->socket_rx, (char *) netswitch->pkt.data, NET_MAX_FRAME + sizeof(netswitch->secret_hash), 0);
-                if (len < sizeof(netswitch->secret_hash) + 12) {
+                /* Receive the secret hash into a scratch header and the frame
+                   straight into the packet buffer, so it needs no strip memmove. */
+                uint8_t hash_hdr[sizeof(netswitch->secret_hash)];
+#ifdef _WIN32
+                WSABUF bufs[2] = {
+                    { .len = sizeof(hash_hdr), .buf = (char *) hash_hdr            },
+                    { .len = NET_MAX_FRAME,    .buf = (char *) netswitch->pkt.data }
+                };
+                DWORD recvd;
+                DWORD rflags = 0;
+                len = (WSARecv(netswitch->socket_rx, bufs, 2, &recvd, &rflags, NULL, NULL) == 0) ? (ssize_t) recvd : -1;
+#else
+                struct iovec iov[2] = {
+                    { .iov_base = hash_hdr,            .iov_len = sizeof(hash_hdr) },
+                    { .iov_base = netswitch->pkt.data, .iov_len = NET_MAX_FRAME    }
+                };
+                struct msghdr msg = {
+                    .msg_iov    = iov,
+                    .msg_iovlen = 2
+                };
+                len = recvmsg(netswitch->socket_rx, &msg, 0);
+#endif
+                if (len < (ssize_t) (sizeof(hash_hdr) + 12)) {
                     netswitch_log("Network Switch: recv error (%d)\n", len);
                     continue;
                 }
 
-                if (memcmp(netswitch->pkt.data, netswitch->secret_hash, sizeof(netswitch->secret_hash)) != 0) {
+                if (memcmp(hash_hdr, netswitch->secret_hash, sizeof(hash_hdr)) != 0) {
                     /* This packet contains a different secret hash, ignore it. */
                     continue;
-                } else {
-                    memmove(netswitch->pkt.data,
-                            netswitch->pkt.data + sizeof(netswitch->secret_hash),
-                            len - sizeof(netswitch->secret_hash));
-                    len = len - sizeof(netswitch->secret_hash);
-                    netswitch->pkt.len = len;
                 }
+                len -= sizeof(hash_hdr);
+                netswitch->pkt.len = len;
             } else {
                 len = recv(netswitch->socket_rx, (char *) netswitch->pkt.data, NET_MAX_FRAME, 0);
                 if (len < 12) {
@@ -464,7 +489,7 @@ net_switch_thread(void *priv)
                 }
             }
 
-            if ((AS_U64(netswitch->pkt.data[netswitch->secret_enabled ? 38 : 6]) & le64_to_cpu(0xffffffffffffULL)) == netswitch->mac_addr_u64) {
+            if ((AS_U64(netswitch->pkt.data[6]) & le64_to_cpu(0xffffffffffffULL)) == netswitch->mac_addr_u64) {
                 /* A packet we've sent has looped back, drop it. */
             } else if (!(net_cards_conf[netswitch->card->card_num].link_state & NET_LINK_DOWN) && (netswitch->promisc || /* promiscuous mode? */
                        (netswitch->pkt.data[0] & 1) || /* broadcast packet? */
@@ -554,8 +579,8 @@ net_switch_init(const netcard_t *card, const uint8_t *mac_addr, void *priv, char
     }
 
     for (int i = 0; i < SWITCH_PKT_BATCH; i++)
-        netswitch->pkt_tx_v[i].data = calloc(1, NET_MAX_FRAME);
-    netswitch->pkt.data = calloc(1, NET_MAX_FRAME);
+        netswitch->pkt_tx_v[i].data = network_bufpool_get();
+    netswitch->pkt.data = network_bufpool_get();
     net_event_init(&netswitch->tx_event);
     net_event_init(&netswitch->stop_event);
 #ifdef _WIN32
@@ -604,8 +629,8 @@ net_switch_close(void *priv)
     net_event_close(&netswitch->stop_event);
     net_event_close(&netswitch->tx_event);
     for (int i = 0; i < SWITCH_PKT_BATCH; i++)
-        free(netswitch->pkt_tx_v[i].data);
-    free(netswitch->pkt.data);
+        network_bufpool_put(netswitch->pkt_tx_v[i].data);
+    network_bufpool_put(netswitch->pkt.data);
     free(netswitch);
 }
 
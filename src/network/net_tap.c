@@ -193,9 +193,9 @@ void net_tap_close(void *priv)
     thread_wait(tap->poll_tid);
     tap_log("TAP: poll thread exited.\n");
     for(int i = 0; i < NET_QUEUE_LEN; i++) {
-        free(tap->pkts_tx[i].data);
+        network_bufpool_put(tap->pkts_tx[i].data);
     }
-    free(tap->pkt_rx.data);
+    network_bufpool_put(tap->pkt_rx.data);
     if (tap->fd >= 0) {
         close(tap->fd);
     }
@@ -320,12 +320,12 @@ net_tap_init(
     if (!tap) {
         goto alloc_fail;
     }
-    tap->pkt_rx.data = calloc(1, NET_MAX_FRAME);
+    tap->pkt_rx.data = network_bufpool_get();
     if (!tap->pkt_rx.data) {
         goto alloc_fail;
     }
     for(int i = 0; i < NET_QUEUE_LEN; i++) {
-        tap->pkts_tx[i].data = calloc(1, NET_MAX_FRAME);
+        tap->pkts_tx[i].data = network_bufpool_get();
         if (!tap->pkts_tx[i].data) {
             goto alloc_fail;
         }
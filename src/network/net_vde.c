@@ -221,9 +221,9 @@ void net_vde_close(void *priv) {
 
     // Free all the mallocs!
     for(i=0;i<VDE_PKT_BATCH; i++) {
-        free(vde->pktv[i].data);
+        network_bufpool_put(vde->pktv[i].data);
     }
-    free(vde->pkt.data);
+    network_bufpool_put(vde->pkt.data);
     f_vde_close(vde->vdeconn);
     net_event_close(&vde->tx_event);
     net_event_close(&vde->stop_event);
@@ -291,9 +291,9 @@ void *net_vde_init(const netcard_t *card, const uint8_t *mac_addr, void *priv, c
     vde_log("VDE: Socket opened (%s).\n", socket_name);
 
     for(uint8_t i = 0; i < VDE_PKT_BATCH; i++) {
-        vde->pktv[i].data = calloc(1, NET_MAX_FRAME);
+        vde->pktv[i].data = network_bufpool_get();
     }
-    vde->pkt.data = calloc(1,NET_MAX_FRAME);
+    vde->pkt.data = network_bufpool_get();
     net_event_init(&vde->tx_event);
     net_event_init(&vde->stop_event);
     vde->poll_tid = thread_create(net_vde_thread, vde);     // Fire up the read-write thread!
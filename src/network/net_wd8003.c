@@ -185,6 +185,14 @@ wd_ram_read(uint32_t addr, void *priv)
     return dev->dp8390->mem[addr & (dev->ram_size - 1)];
 }
 
+static uint16_t
+wd_ram_readw(uint32_t addr, void *priv)
+{
+    const wd_t *dev = (wd_t *) priv;
+
+    return *(uint16_t *) &dev->dp8390->mem[addr & (dev->ram_size - 1)];
+}
+
 static void
 wd_ram_write(uint32_t addr, uint8_t val, void *priv)
 {
@@ -194,6 +202,14 @@ wd_ram_write(uint32_t addr, uint8_t val, void *priv)
     wdlog("WD80x3: RAM Write: addr=%06x, val=%02x\n", addr & (dev->ram_size - 1), val);
 }
 
+static void
+wd_ram_writew(uint32_t addr, uint16_t val, void *priv)
+{
+    wd_t *dev = (wd_t *) priv;
+
+    *(uint16_t *) &dev->dp8390->mem[addr & (dev->ram_size - 1)] = val;
+}
+
 static int
 wd_get_irq_index(wd_t *dev)
 {
@@ -774,9 +790,13 @@ wd_init(const device_t *info)
     wd_reset(dev);
 
     /* Map this system into the memory map. */
+    /* The shared-memory window is plain RAM with no access side effects,
+       so 16-bit accesses are served whole instead of being split into two
+       byte handler calls by the dispatcher - drivers copy frames through
+       here with REP MOVSW. */
     mem_mapping_add(&dev->ram_mapping, dev->ram_addr, dev->ram_size,
-                    wd_ram_read, NULL, NULL,
-                    wd_ram_write, NULL, NULL,
+                    wd_ram_read, wd_ram_readw, NULL,
+                    wd_ram_write, wd_ram_writew, NULL,
                     NULL, MEM_MAPPING_EXTERNAL, dev);
 
     mem_mapping_disable(&dev->ram_mapping);
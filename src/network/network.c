@@ -272,26 +272,64 @@ network_init(void)
 #endif
 }
 
+/* Pool of NET_MAX_FRAME packet buffers, recycled across queue and host
+   driver (re)initialization, which happens on every machine reset. Only
+   accessed from the emulator thread during attach/close, so no locking. */
+#define NET_BUFPOOL_DEPTH (NET_QUEUE_LEN * NET_QUEUE_COUNT * NET_CARD_MAX)
+static uint8_t *net_bufpool[NET_BUFPOOL_DEPTH];
+static int      net_bufpool_count = 0;
+
+uint8_t *
+network_bufpool_get(void)
+{
+    if (net_bufpool_count > 0)
+        return net_bufpool[--net_bufpool_count];
+
+    return calloc(1, NET_MAX_FRAME);
+}
+
+void
+network_bufpool_put(uint8_t *buf)
+{
+    if (!buf)
+        return;
+
+    if (net_bufpool_count < NET_BUFPOOL_DEPTH)
+        net_bufpool[net_bufpool_count++] = buf;
+    else
+        free(buf);
+}
+
 void
 network_queue_init(netqueue_t *queue)
 {
-    queue->head = queue->tail = 0;
+    atomic_store(&queue->head, 0);
+    atomic_store(&queue->tail, 0);
+    queue->cached_head = queue->cached_tail = 0;
     for (int i = 0; i < NET_QUEUE_LEN; i++) {
-        queue->packets[i].data = calloc(1, NET_MAX_FRAME);
+        queue->packets[i].data = network_bufpool_get();
         queue->packets[i].len  = 0;
     }
 }
 
+/* Producer side: only re-read the consumer's tail when the ring looks full. */
 static bool
 network_queue_full(netqueue_t *queue)
 {
-    return ((queue->head + 1) & NET_QUEUE_LEN_MASK) == queue->tail;
+    const int next = (atomic_load_explicit(&queue->head, memory_order_relaxed) + 1) & NET_QUEUE_LEN_MASK;
+    if (next == queue->cached_tail)
+        queue->cached_tail = atomic_load_explicit(&queue->tail, memory_order_acquire);
+    return next == queue->cached_tail;
 }
 
+/* Consumer side: only re-read the producer's head when the ring looks empty. */
 static bool
 network_queue_empty(netqueue_t *queue)
 {
-    return (queue->head == queue->tail);
+    const int tail = atomic_load_explicit(&queue->tail, memory_order_relaxed);
+    if (tail == queue->cached_head)
+        queue->cached_head = atomic_load_explicit(&queue->head, memory_order_acquire);
+    return tail == queue->cached_head;
 }
 
 static inline void
@@ -309,10 +347,11 @@ network_queue_put(netqueue_t *queue, uint8_t *data, int len)
         return 0;
     }
 
-    netpkt_t *pkt = &queue->packets[queue->head];
+    const int head = atomic_load_explicit(&queue->head, memory_order_relaxed);
+    netpkt_t *pkt  = &queue->packets[head];
     memcpy(pkt->data, data, len);
-    pkt->len    = len;
-    queue->head = (queue->head + 1) & NET_QUEUE_LEN_MASK;
+    pkt->len = len;
+    atomic_store_explicit(&queue->head, (head + 1) & NET_QUEUE_LEN_MASK, memory_order_release);
     return 1;
 }
 
@@ -332,10 +371,11 @@ network_queue_put_swap(netqueue_t *queue, netpkt_t *src_pkt)
         return 0;
     }
 
-    netpkt_t *dst_pkt = &queue->packets[queue->head];
+    const int head    = atomic_load_explicit(&queue->head, memory_order_relaxed);
+    netpkt_t *dst_pkt = &queue->packets[head];
     network_swap_packet(src_pkt, dst_pkt);
 
-    queue->head = (queue->head + 1) & NET_QUEUE_LEN_MASK;
+    atomic_store_explicit(&queue->head, (head + 1) & NET_QUEUE_LEN_MASK, memory_order_release);
     return 1;
 }
 
@@ -345,9 +385,10 @@ network_queue_get_swap(netqueue_t *queue, netpkt_t *dst_pkt)
     if (network_queue_empty(queue))
         return 0;
 
-    netpkt_t *src_pkt = &queue->packets[queue->tail];
+    const int tail    = atomic_load_explicit(&queue->tail, memory_order_relaxed);
+    netpkt_t *src_pkt = &queue->packets[tail];
     network_swap_packet(src_pkt, dst_pkt);
-    queue->tail = (queue->tail + 1) & NET_QUEUE_LEN_MASK;
+    atomic_store_explicit(&queue->tail, (tail + 1) & NET_QUEUE_LEN_MASK, memory_order_release);
     return 1;
 }
 
@@ -361,24 +402,68 @@ network_queue_move(netqueue_t *dst_q, netqueue_t *src_q)
         return 0;
     }
 
-    netpkt_t *src_pkt = &src_q->packets[src_q->tail];
-    netpkt_t *dst_pkt = &dst_q->packets[dst_q->head];
+    const int src_tail = atomic_load_explicit(&src_q->tail, memory_order_relaxed);
+    const int dst_head = atomic_load_explicit(&dst_q->head, memory_order_relaxed);
+    netpkt_t *src_pkt  = &src_q->packets[src_tail];
+    netpkt_t *dst_pkt  = &dst_q->packets[dst_head];
 
     network_swap_packet(src_pkt, dst_pkt);
-    dst_q->head = (dst_q->head + 1) & NET_QUEUE_LEN_MASK;
-    src_q->tail = (src_q->tail + 1) & NET_QUEUE_LEN_MASK;
+    /* Grab the length before publishing the slot to the destination consumer. */
+    const int len = dst_pkt->len;
+    atomic_store_explicit(&dst_q->head, (dst_head + 1) & NET_QUEUE_LEN_MASK, memory_order_release);
+    atomic_store_explicit(&src_q->tail, (src_tail + 1) & NET_QUEUE_LEN_MASK, memory_order_release);
 
-    return dst_pkt->len;
+    return len;
 }
 
 void
 network_queue_clear(netqueue_t *queue)
 {
     for (int i = 0; i < NET_QUEUE_LEN; i++) {
-        free(queue->packets[i].data);
+        network_bufpool_put(queue->packets[i].data);
         queue->packets[i].len = 0;
     }
-    queue->tail = queue->head = 0;
+    atomic_store(&queue->head, 0);
+    atomic_store(&queue->tail, 0);
+    queue->cached_head = queue->cached_tail = 0;
+}
+
+static void
+network_coal_timer(void *priv)
+{
+    netcoal_t *coal = (netcoal_t *) priv;
+
+    coal->frames = 0;
+    coal->fire(coal->priv);
+}
+
+void
+network_coal_init(netcoal_t *coal, void (*fire)(void *priv), void *priv)
+{
+    coal->fire   = fire;
+    coal->priv   = priv;
+    coal->frames = 0;
+    timer_add(&coal->timer, network_coal_timer, coal, 0);
+}
+
+void
+network_coal_defer(netcoal_t *coal)
+{
+    if (++coal->frames >= NET_COAL_FRAMES) {
+        network_coal_flush(coal);
+        return;
+    }
+
+    if (!timer_is_enabled(&coal->timer))
+        timer_on_auto(&coal->timer, NET_COAL_USEC);
+}
+
+void
+network_coal_flush(netcoal_t *coal)
+{
+    timer_stop(&coal->timer);
+    coal->frames = 0;
+    coal->fire(coal->priv);
 }
 
 static void
@@ -396,10 +481,7 @@ network_rx_queue(void *priv)
     uint32_t rx_bytes = 0;
     for (int i = 0; i < NET_QUEUE_LEN; i++) {
         if (card->queued_pkt.len == 0) {
-            thread_wait_mutex(card->rx_mutex);
-            int res = network_queue_get_swap(&card->queues[NET_QUEUE_RX], &card->queued_pkt);
-            thread_release_mutex(card->rx_mutex);
-            if (!res)
+            if (!network_queue_get_swap(&card->queues[NET_QUEUE_RX], &card->queued_pkt))
                 break;
         }
 
@@ -413,14 +495,12 @@ network_rx_queue(void *priv)
 
     /* Transmission. */
     uint32_t tx_bytes = 0;
-    thread_wait_mutex(card->tx_mutex);
     for (int i = 0; i < NET_QUEUE_LEN; i++) {
         uint32_t bytes = network_queue_move(&card->queues[NET_QUEUE_TX_HOST], &card->queues[NET_QUEUE_TX_VM]);
         if (!bytes)
             break;
         tx_bytes += bytes;
     }
-    thread_release_mutex(card->tx_mutex);
     if (tx_bytes) {
         /* Notify host that a packet is available in the TX queue */
         card->host_drv.notify_in(card->host_drv.priv);
@@ -455,11 +535,10 @@ network_attach(void *card_drv, uint8_t *mac, NETRXCB rx, NETSETLINKSTATE set_lin
 {
     netcard_t *card       = calloc(1, sizeof(netcard_t));
     int net_type          = net_cards_conf[net_card_current].net_type;
-    card->queued_pkt.data = calloc(1, NET_MAX_FRAME);
+    card->queued_pkt.data = network_bufpool_get();
     card->card_drv        = card_drv;
     card->rx              = rx;
     card->set_link_state  = set_link_state;
-    card->tx_mutex        = thread_create_mutex();
     card->rx_mutex        = thread_create_mutex();
     card->card_num        = net_card_current;
     card->byte_period     = NET_PERIOD_10M;
@@ -531,13 +610,12 @@ network_attach(void *card_drv, uint8_t *mac, NETRXCB rx, NETSETLINKSTATE set_lin
         // If null fails, something is very wrong
         // Clean up and fatal
         if(!card->host_drv.priv) {
-            thread_close_mutex(card->tx_mutex);
             thread_close_mutex(card->rx_mutex);
             for (int i = 0; i < NET_QUEUE_COUNT; i++) {
                 network_queue_clear(&card->queues[i]);
             }
 
-            free(card->queued_pkt.data);
+            network_bufpool_put(card->queued_pkt.data);
             free(card);
             // Placeholder - insert the error message
             fatal("Error initializing the network device: Null driver initialization failed\n");
@@ -558,13 +636,12 @@ netcard_close(netcard_t *card)
     timer_stop(&card->timer);
     card->host_drv.close(card->host_drv.priv);
 
-    thread_close_mutex(card->tx_mutex);
     thread_close_mutex(card->rx_mutex);
     for (int i = 0; i < NET_QUEUE_COUNT; i++) {
         network_queue_clear(&card->queues[i]);
     }
 
-    free(card->queued_pkt.data);
+    network_bufpool_put(card->queued_pkt.data);
     free(card);
 }
 
@@ -620,13 +697,7 @@ network_tx(netcard_t *card, uint8_t *bufp, int len)
 int
 network_tx_pop(netcard_t *card, netpkt_t *out_pkt)
 {
-    int ret = 0;
-
-    thread_wait_mutex(card->tx_mutex);
-    ret = network_queue_get_swap(&card->queues[NET_QUEUE_TX_HOST], out_pkt);
-    thread_release_mutex(card->tx_mutex);
-
-    return ret;
+    return network_queue_get_swap(&card->queues[NET_QUEUE_TX_HOST], out_pkt);
 }
 
 int
@@ -635,7 +706,6 @@ network_tx_popv(netcard_t *card, netpkt_t *pkt_vec, int vec_size)
     int pkt_count = 0;
 
     netqueue_t *queue = &card->queues[NET_QUEUE_TX_HOST];
-    thread_wait_mutex(card->tx_mutex);
     for (int i = 0; i < vec_size; i++) {
         if (!network_queue_get_swap(queue, pkt_vec))
             break;
@@ -643,11 +713,13 @@ network_tx_popv(netcard_t *card, netpkt_t *pkt_vec, int vec_size)
         pkt_count++;
         pkt_vec++;
     }
-    thread_release_mutex(card->tx_mutex);
 
     return pkt_count;
 }
 
+/* The RX queue keeps a producer-side mutex: the host poll thread is the
+   normal producer, but the RTL8139 loopback path injects frames from the
+   emulator thread as well. The consumer side is lock-free. */
 int
 network_rx_put(netcard_t *card, uint8_t *bufp, int len)
 {
@@ -272,21 +272,29 @@ nvr_set_ven_save(void (*ven_save)(void))
 int
 nvr_save(void)
 {
-    const char *path;
-    FILE       *fp;
+    char  path[1024];
+    char  temp_path[1024];
+    FILE *fp;
 
     /* Make sure we have been initialized. */
     if (saved_nvr == NULL)
         return 0;
 
     if (saved_nvr->size != 0) {
-        path = nvr_path(saved_nvr->fn);
+        /* nvr_path() returns a static buffer, so copy before reusing it. */
+        snprintf(path, sizeof(path), "%s", nvr_path(saved_nvr->fn));
+        snprintf(temp_path, sizeof(temp_path), "%s.tmp", path);
         nvr_log("NVR: saving to '%s'\n", path);
-        fp = plat_fopen(path, "wb");
+        /*
+           Write to a temporary file and rename it over the old one, so
+           that a crash mid-write never leaves a truncated NVR file.
+         */
+        fp = plat_fopen(temp_path, "wb");
         if (fp != NULL) {
             /* Save NVR contents to file. */
             (void) fwrite(saved_nvr->regs, saved_nvr->size, 1, fp);
             fclose(fp);
+            plat_rename(temp_path, path);
         }
     }
 
@@ -38,6 +38,8 @@
 #include <86box/acpi.h>
 #include <86box/plat_unused.h>
 
+#include <minitrace/minitrace.h>
+
 enum {
     STATE_NONE = 0,
     STATE_ICW2,
@@ -185,6 +187,11 @@ pic_slave_on(pic_t *dev, int channel)
     return pic_cascade_mode(dev) && (dev->is_master || ((dev->icw4 & 0x0c) == 0x0c)) && (dev->icw3 & (1 << channel));
 }
 
+/* The priority walk below runs only from update_pending(), i.e. when PIC
+   state actually changes (IRR/IMR writes, EOI, end of acknowledge); its
+   result is cached in dev->interrupt and dev->int_pending, which is all
+   the acknowledge paths read.  Keep it that way: picinterrupt() is on
+   the hot path of every hardware interrupt the guest takes. */
 static __inline int
 find_best_interrupt(pic_t *dev)
 {
@@ -296,6 +303,76 @@ pic_set_pci_flag(int pci)
     pic_pci = pci;
 }
 
+#ifdef USE_INSTRUMENT
+/* Per-line interrupt accounting for instrument runs, dumped next to the
+   per-device time table at exit. Latency is measured in tsc ticks from
+   the raise that set the line to the acknowledge that delivers it. */
+typedef struct pic_stat_t {
+    uint64_t raises;
+    uint64_t acks;
+    uint64_t spurious;
+    uint64_t latency;
+    uint64_t raise_tsc; /* 0 = no raise being timed */
+} pic_stat_t;
+
+static pic_stat_t pic_stats[16];
+
+extern double cpuclock;
+
+static void
+pic_stat_raise(uint16_t num)
+{
+    if (!instru_enabled)
+        return;
+
+    for (uint8_t i = 0; i < 16; i++) {
+        if (num & (1 << i)) {
+            pic_stats[i].raises++;
+            /* Force the stamp non-zero so an ack at tsc 0 is not lost. */
+            if (pic_stats[i].raise_tsc == 0)
+                pic_stats[i].raise_tsc = tsc | 1;
+        }
+    }
+}
+
+static void
+pic_stat_ack(int irq)
+{
+    if (!instru_enabled)
+        return;
+
+    pic_stats[irq].acks++;
+    if (pic_stats[irq].raise_tsc != 0) {
+        pic_stats[irq].latency += tsc - (pic_stats[irq].raise_tsc & ~1ULL);
+        pic_stats[irq].raise_tsc = 0;
+    }
+}
+
+static void
+pic_stat_spurious(int irq)
+{
+    if (instru_enabled)
+        pic_stats[irq].spurious++;
+}
+
+void
+pic_stats_dump(void)
+{
+    for (uint8_t i = 0; i < 16; i++) {
+        const pic_stat_t *st = &pic_stats[i];
+
+        if ((st->raises == 0) && (st->acks == 0) && (st->spurious == 0))
+            continue;
+
+        printf("[instrument] IRQ %2i %12llu raises, %12llu acks, %llu spurious, %.1f us avg latency\n",
+               i, (unsigned long long) st->raises, (unsigned long long) st->acks,
+               (unsigned long long) st->spurious,
+               ((st->acks > 0) && (cpuclock > 0.0)) ?
+                   (((double) st->latency / (double) st->acks) * 1000000.0 / cpuclock) : 0.0);
+    }
+}
+#endif
+
 static uint8_t
 pic_level_triggered(pic_t *dev, int irq)
 {
@@ -317,6 +394,12 @@ pic_acknowledge(pic_t *dev)
     int pic_int     = dev->interrupt & 7;
     int pic_int_num = 1 << pic_int;
 
+#ifdef USE_INSTRUMENT
+    pic_stat_ack((dev == &pic2) ? (pic_int | 8) : pic_int);
+#endif
+    /* Input-latency stage 3: the guest takes the interrupt. */
+    MTR_INSTANT_I("irq", "pic_ack", "irq", (intptr_t) ((dev == &pic2) ? (pic_int | 8) : pic_int));
+
     dev->isr |= pic_int_num;
     if (!pic_level_triggered(dev, pic_int) || (dev->lines[pic_int] == 0))
         dev->irr &= ~pic_int_num;
@@ -757,6 +840,9 @@ picint_common(uint16_t num, int level, int set, uint8_t *irq_state)
 
    if (num) {
        if (set) {
+#ifdef USE_INSTRUMENT
+            pic_stat_raise(num);
+#endif
             if (smi_irq_mask & num) {
                 smi_raise();
                 smi_irq_status |= num;
@@ -895,6 +981,9 @@ picinterrupt(void)
                 /* Error correction mechanism: Do a supurious IRQ 15 (spurious IRQ 7 on PIC 2). */
                 pic.slaves[pic.interrupt]->int_pending = 1;
                 pic.slaves[pic.interrupt]->interrupt = 0x07;
+#ifdef USE_INSTRUMENT
+                pic_stat_spurious(15);
+#endif
             } else
                 pic.interrupt |= 0x40; /* Mark slave pending. */
         }
@@ -903,6 +992,9 @@ picinterrupt(void)
            do a spurious IRQ 7. */
         pic.int_pending = 1;
         pic.interrupt = 0x07;
+#ifdef USE_INSTRUMENT
+        pic_stat_spurious(7);
+#endif
     }
 
     if ((pic.interrupt == 0) && (pit_devs[1].data != NULL))
@@ -120,6 +120,12 @@ pitf_ctr_set_using_timer(void *data, int counter_id, int using_timer)
     ctr->using_timer = using_timer;
 }
 
+/* The fast PIT never counts per tick: port reads derive the current
+   count arithmetically from the time remaining on the pc_timer_t, and
+   the timer itself only fires on OUT transitions.  Every OUT transition
+   is guest-observable here -- IRQ0 on counter 0, the port 61h refresh
+   toggle on counter 1, the speaker/cassette on counter 2 -- so none of
+   the expiries can be elided without losing state guests poll for. */
 static int
 pitf_read_timer(ctrf_t *ctr)
 {
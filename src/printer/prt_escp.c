@@ -33,6 +33,7 @@
 #include <86box/plat.h>
 #include <86box/ui.h>
 #include <86box/lpt.h>
+#include <86box/thread.h>
 #include <86box/video.h>
 #include <86box/png_struct.h>
 #include <86box/printer.h>
@@ -237,6 +238,8 @@ typedef struct escp_t {
 
     PALETTE palcol;
 
+    thread_t *dump_thread; /* in-flight page PNG encode */
+
     bool auto_lf;
 } escp_t;
 
@@ -310,15 +313,50 @@ escp_log(const char *fmt, ...)
 #    define escp_log(fmt, ...)
 #endif
 
-/* Dump the current page into a formatted file. */
+typedef struct dump_page_job_t {
+    char     path[1024];
+    uint8_t *pixels;
+    int16_t  w;
+    int16_t  h;
+    uint16_t pitch;
+    PALETTE  palcol;
+} dump_page_job_t;
+
+static void
+dump_page_thread(void *priv)
+{
+    dump_page_job_t *job = (dump_page_job_t *) priv;
+
+    png_write_rgb(job->path, job->pixels, job->w, job->h, job->pitch, job->palcol);
+    free(job->pixels);
+    free(job);
+}
+
+/* Dump the current page into a formatted file. PNG encoding of a full page
+   takes long enough to stall the emulated machine at every form feed, so it
+   runs on its own thread against a snapshot of the page; waiting for the
+   previous encode here keeps at most one copy in flight. */
 static void
 dump_page(escp_t *dev)
 {
-    char path[1024];
+    dump_page_job_t *job = (dump_page_job_t *) malloc(sizeof(dump_page_job_t));
+    size_t           len = (size_t) dev->page->pitch * dev->page->h;
+
+    if (dev->dump_thread) {
+        thread_wait(dev->dump_thread);
+        free(dev->dump_thread);
+    }
 
-    strcpy(path, dev->pagepath);
-    strcat(path, dev->page_fn);
-    png_write_rgb(path, dev->page->pixels, dev->page->w, dev->page->h, dev->page->pitch, dev->palcol);
+    strcpy(job->path, dev->pagepath);
+    strcat(job->path, dev->page_fn);
+    job->pixels = (uint8_t *) malloc(len);
+    memcpy(job->pixels, dev->page->pixels, len);
+    job->w     = dev->page->w;
+    job->h     = dev->page->h;
+    job->pitch = dev->page->pitch;
+    memcpy(job->palcol, dev->palcol, sizeof(PALETTE));
+
+    dev->dump_thread = thread_create(dump_page_thread, job);
 }
 
 static void
@@ -2249,6 +2287,13 @@ escp_close(void *priv)
         if (dev->page->dirty)
             dump_page(dev);
 
+        /* Let the last page finish encoding. */
+        if (dev->dump_thread) {
+            thread_wait(dev->dump_thread);
+            free(dev->dump_thread);
+            dev->dump_thread = NULL;
+        }
+
         if (dev->page->pixels)
             free(dev->page->pixels);
         free(dev->page);
@@ -444,6 +444,20 @@ main_thread_fn()
     uint64_t old_time = elapsed_timer.elapsed();
     int      drawits = frames = 0;
     is_cpu_thread             = 1;
+#ifdef USE_INSTRUMENT
+    uint64_t instru_total_us = 0;
+    int      instru_done     = 0;
+#endif
+    /* Pacing model: drawits accumulates real elapsed milliseconds and each
+       pc_run() slice pays one (or ten) of them back, so the loop is anchored
+       to the wall clock and cannot drift cumulatively - a late wakeup is
+       repaid by running extra slices, bounded at 50 ms so a long host stall
+       skips time instead of fast-forwarding. Sub-millisecond wakeup jitter
+       from plat_delay_ms(1) below is absorbed by the audio buffers and by
+       the renderer's latest-frame-wins blit; spin-finishing the last part
+       of each wait would pin a core on every host for jitter the output
+       paths already hide. Per-slice host timings are available under
+       USE_INSTRUMENT. */
     while (!is_quit && cpu_thread_run) {
         /* See if it is time to run a frame of code. */
         const uint64_t new_time = elapsed_timer.elapsed();
@@ -467,9 +481,17 @@ main_thread_fn()
                 if (instru_enabled) {
                     uint64_t elapsed_us       = (elapsed_timer.nsecsElapsed() - start_time) / 1000;
                     uint64_t total_elapsed_ms = (uint64_t) ((double) tsc / cpu_s->rspeed * 1000);
+                    instru_total_us += elapsed_us;
                     printf("[instrument] %llu, %llu\n", total_elapsed_ms, elapsed_us);
-                    if (instru_run_ms && total_elapsed_ms >= instru_run_ms)
+                    if (instru_run_ms && total_elapsed_ms >= instru_run_ms) {
+                        if (!instru_done) {
+                            instru_done = 1;
+                            printf("[instrument] total: %llu ms guest, %llu ms host, %.1f%% speed\n",
+                                   total_elapsed_ms, instru_total_us / 1000,
+                                   ((double) total_elapsed_ms * 100000.0) / (double) instru_total_us);
+                        }
                         break;
+                    }
                 }
 #endif
                 /* Every 2 emulated seconds we save the machine status. */
@@ -67,6 +67,20 @@ extern bool cpu_thread_running;
 #define SCALE_VIEWPORT 1
 #define SCALE_ABSOLUTE 2
 
+/* Qt may provide GLES-based headers that lack the desktop-only buffer
+   storage enums used for the persistent upload buffers. */
+#ifndef GL_PIXEL_UNPACK_BUFFER
+#    define GL_PIXEL_UNPACK_BUFFER 0x88EC
+#endif
+#ifndef GL_MAP_PERSISTENT_BIT
+#    define GL_MAP_PERSISTENT_BIT 0x0040
+#endif
+#ifndef GL_MAP_COHERENT_BIT
+#    define GL_MAP_COHERENT_BIT 0x0080
+#endif
+
+#define UNPACK_BUFFER_SIZE (2048 * 2048 * 4)
+
 static GLfloat matrix[] = { 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1 };
 
 extern int video_filter_method;
@@ -819,12 +833,12 @@ OpenGLRenderer::OpenGLRenderer(QWidget *parent)
     , renderTimer(new QTimer(this))
 {
     connect(renderTimer, &QTimer::timeout, this, [this]() { this->render(); });
-    imagebufs[0] = std::unique_ptr<uint8_t>(new uint8_t[2048 * 2048 * 4]);
-    imagebufs[1] = std::unique_ptr<uint8_t>(new uint8_t[2048 * 2048 * 4]);
 
-    buf_usage = std::vector<std::atomic_flag>(2);
-    buf_usage[0].clear();
-    buf_usage[1].clear();
+    /* Upload buffers are created in initializeBuffers() once the context
+       is up; getBuffers() is only called after the initialized signal. */
+    buf_usage = std::vector<std::atomic_flag>(3);
+    for (auto &flag : buf_usage)
+        flag.clear();
 
     QSurfaceFormat format;
 
@@ -852,6 +866,85 @@ OpenGLRenderer::OpenGLRenderer(QWidget *parent)
 
 OpenGLRenderer::~OpenGLRenderer() { finalize(); }
 
+void
+OpenGLRenderer::initializeBuffers()
+{
+#ifndef NO_BUFFER_STORAGE
+    /* Try triple-buffered persistent-mapped pixel unpack buffers first:
+       the blitter thread then writes frames directly into upload memory
+       and glTexSubImage2D becomes a DMA from pinned storage instead of a
+       driver-side copy of client memory. Needs GL 4.4 or
+       ARB_buffer_storage. */
+    if ((gl_version[0] > 4 || (gl_version[0] == 4 && gl_version[1] >= 4)) || context->hasExtension(QByteArrayLiteral("GL_ARB_buffer_storage"))) {
+        glBufferStorageFunc = reinterpret_cast<void (QOPENGLF_APIENTRYP)(GLenum, GLsizeiptr, const void *, GLbitfield)>(context->getProcAddress("glBufferStorage"));
+
+        if (glBufferStorageFunc) {
+            /* Read access is included so the raw screenshot path can keep
+               reading frames back out of the blit buffer. */
+            const GLbitfield flags = GL_MAP_READ_BIT | GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+            usePersistentBuffers = true;
+
+            while (glw.glGetError() != GL_NO_ERROR)
+                ;
+
+            for (int i = 0; i < 3; i++) {
+                glw.glGenBuffers(1, &unpack_buffers[i]);
+                glw.glBindBuffer(GL_PIXEL_UNPACK_BUFFER, unpack_buffers[i]);
+                glBufferStorageFunc(GL_PIXEL_UNPACK_BUFFER, UNPACK_BUFFER_SIZE, nullptr, flags);
+                unpack_maps[i] = glw.glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, UNPACK_BUFFER_SIZE, flags);
+
+                if ((glw.glGetError() != GL_NO_ERROR) || !unpack_maps[i]) {
+                    usePersistentBuffers = false;
+                    break;
+                }
+            }
+
+            if (!usePersistentBuffers) {
+                for (int i = 0; i < 3; i++) {
+                    if (unpack_maps[i]) {
+                        glw.glBindBuffer(GL_PIXEL_UNPACK_BUFFER, unpack_buffers[i]);
+                        glw.glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+                        unpack_maps[i] = nullptr;
+                    }
+                    if (unpack_buffers[i]) {
+                        glw.glDeleteBuffers(1, &unpack_buffers[i]);
+                        unpack_buffers[i] = 0;
+                    }
+                }
+            }
+
+            glw.glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+        }
+    }
+#endif
+
+    if (!usePersistentBuffers) {
+        for (auto &buf : imagebufs)
+            buf = std::unique_ptr<uint8_t>(new uint8_t[UNPACK_BUFFER_SIZE]);
+    }
+}
+
+/* Release an upload buffer back to the blitter thread once the GPU is done
+   sourcing it. With wait unset this is a poll; with wait set it blocks (the
+   fence is normally one or more frames old by then, so in practice it has
+   long been signalled). A failed wait releases the buffer anyway rather
+   than leaving it permanently in use. */
+void
+OpenGLRenderer::reclaimBuffer(int i, bool wait)
+{
+    if (!unpack_fences[i])
+        return;
+
+    GLenum res = glw.glClientWaitSync(unpack_fences[i], GL_SYNC_FLUSH_COMMANDS_BIT, wait ? 1000000000ull : 0);
+
+    if (res != GL_TIMEOUT_EXPIRED) {
+        glw.glDeleteSync(unpack_fences[i]);
+        unpack_fences[i] = nullptr;
+        buf_usage[i].clear();
+    }
+}
+
 void
 OpenGLRenderer::initialize()
 {
@@ -1103,6 +1196,8 @@ OpenGLRenderer::initialize()
         glw.glBindBuffer(GL_ARRAY_BUFFER, 0);
         glw.glBindVertexArray(0);
 
+        initializeBuffers();
+
         isInitialized = true;
         isFinalized   = false;
 
@@ -1132,6 +1227,20 @@ OpenGLRenderer::finalize()
 
     context->makeCurrent(this);
 
+    if (usePersistentBuffers) {
+        for (int i = 0; i < 3; i++) {
+            reclaimBuffer(i, true);
+            glw.glBindBuffer(GL_PIXEL_UNPACK_BUFFER, unpack_buffers[i]);
+            glw.glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+            unpack_maps[i] = nullptr;
+        }
+        glw.glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+        glw.glDeleteBuffers(3, unpack_buffers);
+        for (auto &buffer : unpack_buffers)
+            buffer = 0;
+        usePersistentBuffers = false;
+    }
+
     delete_texture(&scene_texture);
 
     if (active_shader) {
@@ -1167,11 +1276,29 @@ OpenGLRenderer::onBlit(int buf_idx, int x, int y, int w, int h)
 
     glw.glBindTexture(GL_TEXTURE_2D, scene_texture.id);
     glw.glPixelStorei(GL_UNPACK_ROW_LENGTH, 2048);
-    glw.glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, w, h, (GLenum) QOpenGLTexture::BGRA, (GLenum) QOpenGLTexture::UInt32_RGBA8_Rev, (const void *) ((uintptr_t) imagebufs[buf_idx].get() + (uintptr_t) (2048 * 4 * y + x * 4)));
+    if (usePersistentBuffers) {
+        glw.glBindBuffer(GL_PIXEL_UNPACK_BUFFER, unpack_buffers[buf_idx]);
+        glw.glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, w, h, (GLenum) QOpenGLTexture::BGRA, (GLenum) QOpenGLTexture::UInt32_RGBA8_Rev, (const void *) (uintptr_t) (2048 * 4 * y + x * 4));
+        glw.glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    } else
+        glw.glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, w, h, (GLenum) QOpenGLTexture::BGRA, (GLenum) QOpenGLTexture::UInt32_RGBA8_Rev, (const void *) ((uintptr_t) imagebufs[buf_idx].get() + (uintptr_t) (2048 * 4 * y + x * 4)));
     glw.glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
     glw.glBindTexture(GL_TEXTURE_2D, 0);
 
-    buf_usage[buf_idx].clear();
+    if (usePersistentBuffers) {
+        /* The mapping must not be rewritten until the GPU has finished
+           sourcing the upload, so the buffer is fenced instead of being
+           released immediately. Outstanding fences are polled here, and
+           the buffer the blitter thread will try next is reclaimed with a
+           blocking wait so a round of dropped frames can never leave the
+           rotation wedged with no upload pending to unblock it. */
+        unpack_fences[buf_idx] = glw.glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+        for (int i = 0; i < 3; i++)
+            reclaimBuffer(i, false);
+        reclaimBuffer((buf_idx + 1) % 3, true);
+    } else
+        buf_usage[buf_idx].clear();
     source.setRect(x, y, w, h);
     this->pixelRatio = devicePixelRatio();
     onResize(this->width(), this->height());
@@ -1197,8 +1324,8 @@ OpenGLRenderer::getBuffers()
 {
     std::vector<std::tuple<uint8_t *, std::atomic_flag *>> buffers;
 
-    buffers.push_back(std::make_tuple(imagebufs[0].get(), &buf_usage[0]));
-    buffers.push_back(std::make_tuple(imagebufs[1].get(), &buf_usage[1]));
+    for (int i = 0; i < 3; i++)
+        buffers.push_back(std::make_tuple(usePersistentBuffers ? (uint8_t *) unpack_maps[i] : imagebufs[i].get(), &buf_usage[i]));
 
     return buffers;
 }
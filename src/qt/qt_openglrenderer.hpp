@@ -82,7 +82,18 @@ protected:
     bool event(QEvent *event) override;
 
 private:
-    std::array<std::unique_ptr<uint8_t>, 2> imagebufs;
+    std::array<std::unique_ptr<uint8_t>, 3> imagebufs;
+
+    /* Triple-buffered persistent-mapped pixel unpack buffers: the blitter
+       thread writes each frame directly into upload memory, and buffer
+       reuse is gated on a fence per upload instead of a synchronous copy.
+       Falls back to plain heap buffers when buffer storage is unavailable. */
+    bool   usePersistentBuffers = false;
+    GLuint unpack_buffers[3]    = { 0, 0, 0 };
+    void  *unpack_maps[3]       = { nullptr, nullptr, nullptr };
+    GLsync unpack_fences[3]     = { nullptr, nullptr, nullptr };
+
+    void (QOPENGLF_APIENTRYP glBufferStorageFunc)(GLenum target, GLsizeiptr size, const void *data, GLbitfield flags) = nullptr;
 
     QTimer *renderTimer;
 
@@ -105,6 +116,7 @@ private:
     void initialize();
     void initializeExtensions();
     void initializeBuffers();
+    void reclaimBuffer(int i, bool wait);
     void applyOptions();
 
     void create_scene_shader();
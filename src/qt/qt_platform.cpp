@@ -112,6 +112,7 @@ extern "C" {
 #        define NOMINMAX
 #    endif
 #    include <windows.h>
+#    include <io.h>
 #    include <86box/win.h>
 #else
 #    include <strings.h>
@@ -423,6 +424,18 @@ plat_remove(char *path)
     QFile(path).remove();
 }
 
+void
+plat_rename(char *old_path, char *new_path)
+{
+#ifdef _WIN32
+    auto old_data = QString::fromUtf8(old_path).toStdWString();
+    auto new_data = QString::fromUtf8(new_path).toStdWString();
+    MoveFileExW(old_data.c_str(), new_data.c_str(), MOVEFILE_REPLACE_EXISTING);
+#else
+    rename(old_path, new_path);
+#endif
+}
+
 void *
 plat_mmap(size_t size, uint8_t executable)
 {
@@ -442,6 +455,19 @@ plat_mmap(size_t size, uint8_t executable)
 #endif
 }
 
+void
+plat_mmap_zero(void *ptr, size_t size)
+{
+#if defined Q_OS_LINUX
+    /* On an anonymous private mapping this both rezeroes the range and
+       returns the backing pages to the host, so zeroing guest RAM also
+       drops it from RSS until the guest touches it again. */
+    if (!madvise(ptr, size, MADV_DONTNEED))
+        return;
+#endif
+    memset(ptr, 0x00, size);
+}
+
 void
 plat_munmap(void *ptr, size_t size)
 {
@@ -452,6 +478,47 @@ plat_munmap(void *ptr, size_t size)
 #endif
 }
 
+void *
+plat_mmap_file(FILE *fp, uint64_t size)
+{
+    if (size != (uint64_t) (size_t) size)
+        return nullptr;
+
+#if defined Q_OS_WINDOWS
+    HANDLE fh = (HANDLE) _get_osfhandle(_fileno(fp));
+    if (fh == INVALID_HANDLE_VALUE)
+        return nullptr;
+    HANDLE mh = CreateFileMappingW(fh, NULL, PAGE_READWRITE, 0, 0, NULL);
+    if (mh == NULL)
+        return nullptr;
+    void *ret = MapViewOfFile(mh, FILE_MAP_ALL_ACCESS, 0, 0, (SIZE_T) size);
+    /* The view keeps the section alive. */
+    CloseHandle(mh);
+    return ret;
+#else
+    void *ret = mmap(0, (size_t) size, PROT_READ | PROT_WRITE, MAP_SHARED, fileno(fp), 0);
+    if (ret == MAP_FAILED)
+        return nullptr;
+
+#    ifdef MADV_WILLNEED
+    (void) madvise(ret, (size_t) size, MADV_WILLNEED);
+#    endif
+
+    return ret;
+#endif
+}
+
+void
+plat_munmap_file(void *ptr, uint64_t size)
+{
+#if defined Q_OS_WINDOWS
+    (void) size;
+    UnmapViewOfFile(ptr);
+#else
+    munmap(ptr, (size_t) size);
+#endif
+}
+
 extern bool cpu_thread_running;
 
 #ifdef Q_OS_WINDOWS
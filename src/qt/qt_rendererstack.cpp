@@ -499,6 +499,16 @@ take_screenshot_clipboard_monitor(int sx, int sy, int sw, int sh, int i)
 }
 
 // called from blitter thread
+//
+// Presentation is already decoupled from the guest's refresh at three
+// points: svga_doblit() drops frames with no VRAM/register change (via
+// the changedvram bookkeeping), so idle guests never reach this path at
+// all; here, a frame arriving while the target image buffer is still in
+// flight is dropped (the test_and_set below), which is latest-frame-wins
+// backpressure when a 70 Hz guest outruns the renderer; and host vsync
+// pacing belongs to the renderer backends (swap interval / present
+// mode).  Content hashing would only re-detect what changedvram already
+// knows for free.
 void
 RendererStack::blit(int x, int y, int w, int h)
 {
@@ -364,14 +364,26 @@ VulkanRenderer2::ensureTexture()
             m_texStagingTransferLayout = true;
         }
 
+        /* Only copy the region the scene quad actually samples, padded one
+           texel on each side for bilinear filtering; the staging image
+           outside it never changes, and copying the full 2048x2048 texture
+           every frame wastes transfer bandwidth. */
+        QRect copyRect(0, 0, m_texSize.width(), m_texSize.height());
+        auto *vkwin = qobject_cast<VulkanWindowRenderer *>(m_window);
+        if (vkwin && !vkwin->source.isEmpty())
+            copyRect = vkwin->source.adjusted(-1, -1, 1, 1).intersected(copyRect);
+
         VkImageCopy copyInfo;
         memset(&copyInfo, 0, sizeof(copyInfo));
         copyInfo.srcSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
         copyInfo.srcSubresource.layerCount = 1;
         copyInfo.dstSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
         copyInfo.dstSubresource.layerCount = 1;
-        copyInfo.extent.width              = m_texSize.width();
-        copyInfo.extent.height             = m_texSize.height();
+        copyInfo.srcOffset.x               = copyRect.x();
+        copyInfo.srcOffset.y               = copyRect.y();
+        copyInfo.dstOffset                 = copyInfo.srcOffset;
+        copyInfo.extent.width              = copyRect.width();
+        copyInfo.extent.height             = copyRect.height();
         copyInfo.extent.depth              = 1;
         m_devFuncs->vkCmdCopyImage(cb, m_texStaging, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
                                    m_texImage, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &copyInfo);
@@ -889,6 +901,10 @@ VulkanRenderer2::releaseResources()
     }
 
     if (m_bufMem) {
+        if (m_bufMappedPtr) {
+            m_devFuncs->vkUnmapMemory(dev, m_bufMem);
+            m_bufMappedPtr = nullptr;
+        }
         m_devFuncs->vkFreeMemory(dev, m_bufMem, nullptr);
         m_bufMem = VK_NULL_HANDLE;
     }
@@ -926,23 +942,18 @@ VulkanRenderer2::startNextFrame()
     VkCommandBuffer cmdBuf               = m_window->currentCommandBuffer();
     m_devFuncs->vkCmdBeginRenderPass(cmdBuf, &rpBeginInfo, VK_SUBPASS_CONTENTS_INLINE);
 
-    quint8  *p;
-    VkResult err = m_devFuncs->vkMapMemory(dev, m_bufMem, m_uniformBufInfo[m_window->currentFrame()].offset,
-                                           UNIFORM_DATA_SIZE, 0, reinterpret_cast<void **>(&p));
-    if (err != VK_SUCCESS)
-        qFatal("Failed to map memory: %d", err);
+    if (!m_bufMappedPtr) {
+        VkResult err = m_devFuncs->vkMapMemory(dev, m_bufMem, 0, VK_WHOLE_SIZE, 0, &m_bufMappedPtr);
+        if (err != VK_SUCCESS)
+            qFatal("Failed to map memory: %d", err);
+    }
+
+    quint8    *p = reinterpret_cast<quint8 *>(m_bufMappedPtr) + m_uniformBufInfo[m_window->currentFrame()].offset;
     QMatrix4x4 m = m_proj;
     memcpy(p, m.constData(), 16 * sizeof(float));
-    m_devFuncs->vkUnmapMemory(dev, m_bufMem);
-    p = nullptr;
 
     // Second pass for texture coordinates.
-    err = m_devFuncs->vkMapMemory(dev, m_bufMem, 0,
-                                  sizeof(vertexData), 0, reinterpret_cast<void **>(&p));
-    if (err != VK_SUCCESS)
-        qFatal("Failed to map memory: %d", err);
-
-    float *floatData   = (float *) p;
+    float *floatData   = (float *) m_bufMappedPtr;
     auto   source      = qobject_cast<VulkanWindowRenderer *>(m_window)->source;
     auto   destination = qobject_cast<VulkanWindowRenderer *>(m_window)->destination;
     floatData[3]       = (float) source.x() / 2048.f;
@@ -954,8 +965,6 @@ VulkanRenderer2::startNextFrame()
     floatData[18]      = (float) (source.x() + source.width()) / 2048.f;
     floatData[14]      = (float) (source.y() + source.height()) / 2048.f;
 
-    m_devFuncs->vkUnmapMemory(dev, m_bufMem);
-
     m_devFuncs->vkCmdBindPipeline(cb, VK_PIPELINE_BIND_POINT_GRAPHICS, m_pipeline);
     m_devFuncs->vkCmdBindDescriptorSets(cb, VK_PIPELINE_BIND_POINT_GRAPHICS, m_pipelineLayout, 0, 1,
                                         &m_descSet[m_window->currentFrame()], 0, nullptr);
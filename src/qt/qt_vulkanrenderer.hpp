@@ -67,6 +67,10 @@ private:
 
     VkDeviceMemory         m_bufMem = VK_NULL_HANDLE;
     VkBuffer               m_buf    = VK_NULL_HANDLE;
+    /* Persistent mapping of m_bufMem (host visible and coherent), so the
+       per-frame uniform and texture coordinate updates don't map and unmap
+       the allocation twice every frame. */
+    void                  *m_bufMappedPtr = nullptr;
     VkDescriptorBufferInfo m_uniformBufInfo[QVulkanWindow::MAX_CONCURRENT_FRAME_COUNT];
 
     VkDescriptorPool      m_descPool      = VK_NULL_HANDLE;
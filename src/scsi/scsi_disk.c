@@ -783,22 +783,22 @@ scsi_disk_blocks(scsi_disk_t *dev, int32_t *len, UNUSED(int first_batch), const
 
     *len = dev->requested_blocks << 9;
 
-    for (int i = 0; i < dev->requested_blocks; i++) {
-        if (out) {
-            if (hdd_image_write(dev->id, dev->sector_pos, 1, dev->temp_buffer +
-                                (i << 9)) < 0) {
-                scsi_disk_write_error(dev);
-                return -1;
-            }
-        } else {
-            if (hdd_image_read(dev->id, dev->sector_pos, 1, dev->temp_buffer +
-                               (i << 9)) < 0) {
-                scsi_disk_read_error(dev);
-                return -1;
-            }
+    /* The blocks are contiguous, so move them with a single image call
+       instead of one call (and its seek) per sector. */
+    if (out) {
+        if (hdd_image_write(dev->id, dev->sector_pos, dev->requested_blocks,
+                            dev->temp_buffer) < 0) {
+            scsi_disk_write_error(dev);
+            return -1;
+        }
+    } else {
+        if (hdd_image_read(dev->id, dev->sector_pos, dev->requested_blocks,
+                           dev->temp_buffer) < 0) {
+            scsi_disk_read_error(dev);
+            return -1;
         }
-        dev->sector_pos++;
     }
+    dev->sector_pos += dev->requested_blocks;
 
     scsi_disk_log(dev->log, "%s %i bytes of blocks...\n", out ? "Written" : "Read", *len);
 
@@ -35,9 +35,10 @@ typedef struct fluidsynth {
     fluid_synth_t    *synth;
     int               samplerate;
     int               sound_font;
+    char              sound_font_path[4096];
 
     thread_t *thread_h;
-    event_t  *event, *start_event;
+    event_t  *event;
     int       buf_size;
     float    *buffer;
     int16_t  *buffer_int16;
@@ -72,7 +73,13 @@ fluidsynth_thread(void *param)
     int           buf_pos  = 0;
     int           buf_size = data->buf_size / BUFFER_SEGMENTS;
 
-    thread_set_event(data->start_event);
+    /* Load the sound font here rather than in init: parsing a large SF2
+       can take seconds and has no business gating machine start. The
+       fluid_synth_* entry points are thread-safe, so MIDI messages that
+       arrive in the meantime are accepted and simply sound once the bank
+       is in. */
+    if (data->sound_font_path[0])
+        data->sound_font = fluid_synth_sfload(data->synth, data->sound_font_path, 1);
 
     while (data->on) {
         thread_wait_event(data->event, -1);
@@ -186,7 +193,8 @@ fluidsynth_init(UNUSED(const device_t *info))
         }
     }
 #endif
-    data->sound_font = fluid_synth_sfload(data->synth, sound_font, 1);
+    if (sound_font)
+        strncpy(data->sound_font_path, sound_font, sizeof(data->sound_font_path) - 1);
 
     if (device_get_config_int("chorus")) {
 #ifndef USE_OLD_FLUIDSYNTH_API
@@ -288,14 +296,9 @@ fluidsynth_init(UNUSED(const device_t *info))
 
     data->on = 1;
 
-    data->start_event = thread_create_event();
-
     data->event    = thread_create_event();
     data->thread_h = thread_create(fluidsynth_thread, data);
 
-    thread_wait_event(data->start_event, -1);
-    thread_reset_event(data->start_event);
-
     return dev;
 }
 
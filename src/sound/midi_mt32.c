@@ -109,6 +109,62 @@ static const mt32emu_report_handler_i handler_cm32l = { &handler_cm32l_v0 };
 static mt32emu_context context         = NULL;
 static int             roms_present[2] = { -1, -1 };
 
+/* The ROM images are kept loaded across synth re-initializations (hard
+   resets, settings changes), so reopening the device does not have to read
+   the files from disk again.  mt32emu_add_rom_data() uses the buffers in
+   place, so the cached data must outlive the context; it is simply kept for
+   the lifetime of the process.  The SHA1 digests are saved after the first
+   successful open so that later opens skip recomputing them as well. */
+typedef struct mt32_rom_cache_t {
+    char                path[512];
+    uint8_t            *data;
+    size_t              size;
+    mt32emu_sha1_digest sha1;
+    int                 sha1_valid;
+} mt32_rom_cache_t;
+
+static mt32_rom_cache_t rom_cache[2];
+
+static const uint8_t *
+mt32_cache_rom(const char *path, size_t *size, int slot)
+{
+    mt32_rom_cache_t *cache = &rom_cache[slot];
+    FILE             *fp;
+    long              len;
+
+    if (cache->data && !strcmp(cache->path, path)) {
+        *size = cache->size;
+        return cache->data;
+    }
+
+    free(cache->data);
+    cache->data       = NULL;
+    cache->sha1_valid = 0;
+
+    fp = plat_fopen(path, "rb");
+    if (fp == NULL)
+        return NULL;
+    if (fseek(fp, 0, SEEK_END) || ((len = ftell(fp)) <= 0)) {
+        fclose(fp);
+        return NULL;
+    }
+    fseek(fp, 0, SEEK_SET);
+
+    cache->data = malloc(len);
+    if (!cache->data || (fread(cache->data, 1, len, fp) != (size_t) len)) {
+        fclose(fp);
+        free(cache->data);
+        cache->data = NULL;
+        return NULL;
+    }
+    fclose(fp);
+
+    strncpy(cache->path, path, sizeof(cache->path) - 1);
+    cache->size = (size_t) len;
+    *size       = (size_t) len;
+    return cache->data;
+}
+
 mt32emu_return_code
 mt32_check(UNUSED(const char *func), mt32emu_return_code ret, mt32emu_return_code expected)
 {
@@ -263,21 +319,39 @@ mt32emu_init(char *control_rom, char *pcm_rom)
 {
     midi_device_t *dev;
     char           fn[512];
+    const uint8_t *rom_data;
+    size_t         rom_size = 0;
 
     context = mt32emu_create_context(strstr(control_rom, "MT32_CONTROL.ROM") ? handler_mt32 : handler_cm32l, NULL);
 
     if (!rom_getfile(control_rom, fn, 512))
         return 0;
-    if (!mt32_check("mt32emu_add_rom_file", mt32emu_add_rom_file(context, fn), MT32EMU_RC_ADDED_CONTROL_ROM))
+    rom_data = mt32_cache_rom(fn, &rom_size, 0);
+    if (!rom_data || !mt32_check("mt32emu_add_rom_data", mt32emu_add_rom_data(context, rom_data, rom_size, rom_cache[0].sha1_valid ? (const mt32emu_sha1_digest *) rom_cache[0].sha1 : NULL), MT32EMU_RC_ADDED_CONTROL_ROM))
         return 0;
     if (!rom_getfile(pcm_rom, fn, 512))
         return 0;
-    if (!mt32_check("mt32emu_add_rom_file", mt32emu_add_rom_file(context, fn), MT32EMU_RC_ADDED_PCM_ROM))
+    rom_data = mt32_cache_rom(fn, &rom_size, 1);
+    if (!rom_data || !mt32_check("mt32emu_add_rom_data", mt32emu_add_rom_data(context, rom_data, rom_size, rom_cache[1].sha1_valid ? (const mt32emu_sha1_digest *) rom_cache[1].sha1 : NULL), MT32EMU_RC_ADDED_PCM_ROM))
         return 0;
 
     if (!mt32_check("mt32emu_open_synth", mt32emu_open_synth(context), MT32EMU_RC_OK))
         return 0;
 
+    if (!rom_cache[0].sha1_valid || !rom_cache[1].sha1_valid) {
+        mt32emu_rom_info rom_info;
+
+        mt32emu_get_rom_info(context, &rom_info);
+        if (rom_info.control_rom_sha1_digest) {
+            strncpy(rom_cache[0].sha1, rom_info.control_rom_sha1_digest, sizeof(mt32emu_sha1_digest) - 1);
+            rom_cache[0].sha1_valid = 1;
+        }
+        if (rom_info.pcm_rom_sha1_digest) {
+            strncpy(rom_cache[1].sha1, rom_info.pcm_rom_sha1_digest, sizeof(mt32emu_sha1_digest) - 1);
+            rom_cache[1].sha1_valid = 1;
+        }
+    }
+
     samplerate = mt32emu_get_actual_stereo_output_samplerate(context);
     /* buf_size = samplerate/RENDER_RATE*2; */
     if (sound_is_float) {
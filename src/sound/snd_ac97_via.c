@@ -620,11 +620,15 @@ ac97_via_sgd_process(void *priv)
     if (!(sgd_status & 0x80))
         return;
 
-    /* Schedule next run. */
-    timer_on_auto(&sgd->dma_timer, 1.0);
-
-    /* Process SGD if it's active, and the FIFO has room or is disabled. */
-    if (((sgd_status & 0xc7) == 0x80) && (sgd->always_run || ((sgd->fifo_end - sgd->fifo_pos) <= (sizeof(sgd->fifo) - 4)))) {
+    /* Process SGD while it's active, and the FIFO has room or is disabled.
+       The whole refill is batched into one run: a block-end inside the loop
+       raises its flags and interrupts before the next iteration re-checks
+       the status, so STOP/termination still take effect mid-batch. The
+       iteration bound keeps a degenerate table of zero-length blocks from
+       spinning here forever; such a table just advances at the old pace. */
+    int runs = 16;
+
+    while ((runs-- > 0) && ((dev->sgd_regs[sgd->id] & 0xc4) == 0x80) && (sgd->always_run || ((sgd->fifo_end - sgd->fifo_pos) <= (sizeof(sgd->fifo) - 4)))) {
         /* Move on to the next block if no entry is present. */
         if (sgd->restart) {
             /* (Re)load entry pointer if required. */
@@ -653,18 +657,28 @@ ac97_via_sgd_process(void *priv)
                          sgd->entry_ptr - 8, sgd->sample_ptr, sgd->sample_count, sgd->entry_flags);
         }
 
+        /* Transfer as much of the block as the FIFO can take in one DMA
+           call, splitting only at the FIFO wrap point. Room, the wrap
+           offset and the (rounded-up) remaining count are all multiples
+           of 4, so this degenerates to the old one-dword transfer at the
+           boundaries. */
+        uint32_t fifo_off = sgd->fifo_end & (sizeof(sgd->fifo) - 1);
+        int32_t  chunk    = sgd->always_run ? 4 : (sizeof(sgd->fifo) - (sgd->fifo_end - sgd->fifo_pos));
+        if (chunk > ((sgd->sample_count + 3) & ~3))
+            chunk = (sgd->sample_count + 3) & ~3;
+        if (chunk > (int32_t) (sizeof(sgd->fifo) - fifo_off))
+            chunk = sizeof(sgd->fifo) - fifo_off;
+
         if (sgd->id & 0x10) {
             /* Write channel: read data from FIFO. */
-            // mem_writel_phys(sgd->sample_ptr, AS_U32(sgd->fifo[sgd->fifo_end & (sizeof(sgd->fifo) - 1)]));
-            dma_bm_write(sgd->sample_ptr, &sgd->fifo[sgd->fifo_end & (sizeof(sgd->fifo) - 1)], 4, 4);
+            dma_bm_write(sgd->sample_ptr, &sgd->fifo[fifo_off], chunk, 4);
         } else {
             /* Read channel: write data to FIFO. */
-            // AS_U32(sgd->fifo[sgd->fifo_end & (sizeof(sgd->fifo) - 1)]) = mem_readl_phys(sgd->sample_ptr);
-            dma_bm_read(sgd->sample_ptr, &sgd->fifo[sgd->fifo_end & (sizeof(sgd->fifo) - 1)], 4, 4);
+            dma_bm_read(sgd->sample_ptr, &sgd->fifo[fifo_off], chunk, 4);
         }
-        sgd->fifo_end += 4;
-        sgd->sample_ptr += 4;
-        sgd->sample_count -= 4;
+        sgd->fifo_end += chunk;
+        sgd->sample_ptr += chunk;
+        sgd->sample_count -= chunk;
 
         /* Check if we've hit the end of this block. */
         if (sgd->sample_count <= 0) {
@@ -724,7 +738,21 @@ ac97_via_sgd_process(void *priv)
             /* Fire any requested status interrupts. */
             ac97_via_update_irqs(dev);
         }
+
+        /* FIFO backpressure doesn't apply to free-running SGDs; keep their
+           legacy one-dword-per-run cadence. */
+        if (sgd->always_run)
+            break;
     }
+
+    /* Schedule next run. With the FIFO topped up, nothing can happen until
+       the poller drains a sample, so back off; the fastest consumer takes a
+       dword every 20.8 us at 48 kHz. Paused or free-running SGDs keep the
+       old polling interval so they resume just as quickly. */
+    if (!sgd->always_run && ((dev->sgd_regs[sgd->id] & 0xc4) == 0x80) && ((sgd->fifo_end - sgd->fifo_pos) > (sizeof(sgd->fifo) - 4)))
+        timer_on_auto(&sgd->dma_timer, 10.0);
+    else
+        timer_on_auto(&sgd->dma_timer, 1.0);
 }
 
 static void
@@ -31,6 +31,7 @@
 
 #include <86box/86box.h>
 #include <86box/device.h>
+#include <86box/dma.h>
 #include <86box/gameport.h>
 #include <86box/io.h>
 #include <86box/mem.h>
@@ -2224,77 +2225,57 @@ es137x_fetch(es137x_t *dev, int dac_nr)
     int pos    = dev->dac[dac_nr].buffer_pos & 63;
     int c;
 
+    /* Fetch the frame run in one bus-master transfer instead of one phys
+       accessor call per byte or word, capped at the frame-count wrap so the
+       loop boundary still resets the address to the latch. The count is in
+       dwords, and count <= size holds on entry, so at least one dword is
+       always transferred. */
+    uint8_t  page[32];
+    uint32_t dwords = dev->dac[dac_nr].size - dev->dac[dac_nr].count + 1;
+
+    if (dwords > ((format == FORMAT_STEREO_16) ? 4 : 8))
+        dwords = (format == FORMAT_STEREO_16) ? 4 : 8;
+
+    dma_bm_read(dev->dac[dac_nr].addr, page, dwords * 4, 4);
+    dev->dac[dac_nr].addr += dwords * 4;
+    dev->dac[dac_nr].count += dwords;
+
+    if (dev->dac[dac_nr].count > dev->dac[dac_nr].size) {
+        dev->dac[dac_nr].count = 0;
+        dev->dac[dac_nr].addr  = dev->dac[dac_nr].addr_latch;
+    }
+
     switch (format) {
         case FORMAT_MONO_8:
-            for (c = 0; c < 32; c += 4) {
-                dev->dac[dac_nr].buffer_l[(pos + c) & 63] = dev->dac[dac_nr].buffer_r[(pos + c) & 63] = (mem_readb_phys(dev->dac[dac_nr].addr) ^ 0x80) << 8;
-                dev->dac[dac_nr].buffer_l[(pos + c + 1) & 63] = dev->dac[dac_nr].buffer_r[(pos + c + 1) & 63] = (mem_readb_phys(dev->dac[dac_nr].addr + 1) ^ 0x80) << 8;
-                dev->dac[dac_nr].buffer_l[(pos + c + 2) & 63] = dev->dac[dac_nr].buffer_r[(pos + c + 2) & 63] = (mem_readb_phys(dev->dac[dac_nr].addr + 2) ^ 0x80) << 8;
-                dev->dac[dac_nr].buffer_l[(pos + c + 3) & 63] = dev->dac[dac_nr].buffer_r[(pos + c + 3) & 63] = (mem_readb_phys(dev->dac[dac_nr].addr + 3) ^ 0x80) << 8;
-                dev->dac[dac_nr].addr += 4;
-
-                dev->dac[dac_nr].buffer_pos_end += 4;
-                dev->dac[dac_nr].count++;
-
-                if (dev->dac[dac_nr].count > dev->dac[dac_nr].size) {
-                    dev->dac[dac_nr].count = 0;
-                    dev->dac[dac_nr].addr  = dev->dac[dac_nr].addr_latch;
-                    break;
-                }
-            }
+            for (c = 0; c < (int) (dwords * 4); c++)
+                dev->dac[dac_nr].buffer_l[(pos + c) & 63] = dev->dac[dac_nr].buffer_r[(pos + c) & 63] = (page[c] ^ 0x80) << 8;
+
+            dev->dac[dac_nr].buffer_pos_end += dwords * 4;
             break;
 
         case FORMAT_STEREO_8:
-            for (c = 0; c < 16; c += 2) {
-                dev->dac[dac_nr].buffer_l[(pos + c) & 63]     = (mem_readb_phys(dev->dac[dac_nr].addr) ^ 0x80) << 8;
-                dev->dac[dac_nr].buffer_r[(pos + c) & 63]     = (mem_readb_phys(dev->dac[dac_nr].addr + 1) ^ 0x80) << 8;
-                dev->dac[dac_nr].buffer_l[(pos + c + 1) & 63] = (mem_readb_phys(dev->dac[dac_nr].addr + 2) ^ 0x80) << 8;
-                dev->dac[dac_nr].buffer_r[(pos + c + 1) & 63] = (mem_readb_phys(dev->dac[dac_nr].addr + 3) ^ 0x80) << 8;
-                dev->dac[dac_nr].addr += 4;
-
-                dev->dac[dac_nr].buffer_pos_end += 2;
-                dev->dac[dac_nr].count++;
-
-                if (dev->dac[dac_nr].count > dev->dac[dac_nr].size) {
-                    dev->dac[dac_nr].count = 0;
-                    dev->dac[dac_nr].addr  = dev->dac[dac_nr].addr_latch;
-                    break;
-                }
+            for (c = 0; c < (int) (dwords * 2); c++) {
+                dev->dac[dac_nr].buffer_l[(pos + c) & 63] = (page[(c * 2)] ^ 0x80) << 8;
+                dev->dac[dac_nr].buffer_r[(pos + c) & 63] = (page[(c * 2) + 1] ^ 0x80) << 8;
             }
+
+            dev->dac[dac_nr].buffer_pos_end += dwords * 2;
             break;
 
         case FORMAT_MONO_16:
-            for (c = 0; c < 16; c += 2) {
-                dev->dac[dac_nr].buffer_l[(pos + c) & 63] = dev->dac[dac_nr].buffer_r[(pos + c) & 63] = mem_readw_phys(dev->dac[dac_nr].addr);
-                dev->dac[dac_nr].buffer_l[(pos + c + 1) & 63] = dev->dac[dac_nr].buffer_r[(pos + c + 1) & 63] = mem_readw_phys(dev->dac[dac_nr].addr + 2);
-                dev->dac[dac_nr].addr += 4;
-
-                dev->dac[dac_nr].buffer_pos_end += 2;
-                dev->dac[dac_nr].count++;
+            for (c = 0; c < (int) (dwords * 2); c++)
+                dev->dac[dac_nr].buffer_l[(pos + c) & 63] = dev->dac[dac_nr].buffer_r[(pos + c) & 63] = (uint16_t) (page[(c * 2)] | (page[(c * 2) + 1] << 8));
 
-                if (dev->dac[dac_nr].count > dev->dac[dac_nr].size) {
-                    dev->dac[dac_nr].count = 0;
-                    dev->dac[dac_nr].addr  = dev->dac[dac_nr].addr_latch;
-                    break;
-                }
-            }
+            dev->dac[dac_nr].buffer_pos_end += dwords * 2;
             break;
 
         case FORMAT_STEREO_16:
-            for (c = 0; c < 4; c++) {
-                dev->dac[dac_nr].buffer_l[(pos + c) & 63] = mem_readw_phys(dev->dac[dac_nr].addr);
-                dev->dac[dac_nr].buffer_r[(pos + c) & 63] = mem_readw_phys(dev->dac[dac_nr].addr + 2);
-                dev->dac[dac_nr].addr += 4;
-
-                dev->dac[dac_nr].buffer_pos_end++;
-                dev->dac[dac_nr].count++;
-
-                if (dev->dac[dac_nr].count > dev->dac[dac_nr].size) {
-                    dev->dac[dac_nr].count = 0;
-                    dev->dac[dac_nr].addr  = dev->dac[dac_nr].addr_latch;
-                    break;
-                }
+            for (c = 0; c < (int) dwords; c++) {
+                dev->dac[dac_nr].buffer_l[(pos + c) & 63] = (uint16_t) (page[(c * 4)] | (page[(c * 4) + 1] << 8));
+                dev->dac[dac_nr].buffer_r[(pos + c) & 63] = (uint16_t) (page[(c * 4) + 2] | (page[(c * 4) + 3] << 8));
             }
+
+            dev->dac[dac_nr].buffer_pos_end += dwords;
             break;
 
         default:
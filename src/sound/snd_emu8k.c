@@ -1776,6 +1776,25 @@ emu8k_update(emu8k_t *emu8k)
         emu_voice = &emu8k->voice[c];
         buf       = &emu8k->buffer[emu8k->pos * 2];
 
+        /* Output gating is invariant across the block: hwcf3 only changes
+           through I/O and ccca is only rewritten after the sample loop. */
+        const int audible = (emu8k->hwcf3 & 0x04) && !CCCA_DMA_ACTIVE(emu_voice->ccca);
+
+        /* A silent voice whose per-sample state update is a fixed point
+           (envelope engine off, volume and pitch zero with nowhere to
+           slide to, no loop wrap pending) ends the block in the same
+           state whether stepped once or once per sample - step it once
+           instead of running the sample loop. */
+        if (!emu_voice->env_engine_on && !emu_voice->cvcf_curr_volume
+            && !emu_voice->vtft_vol_target && !emu_voice->volumeslide.last
+            && !emu_voice->cpf_curr_pitch && !emu_voice->ptrx_pit_target
+            && (emu_voice->addr.addr < emu_voice->loop_end.addr)) {
+            emu_voice->cvcf_curr_filt_ctoff = emu_voice->vtft_filter_target;
+            emu_voice->ccca                 = (((uint32_t) emu_voice->ccca_qcontrol) << 24) | emu_voice->addr.int_address;
+            emu_voice->cpf_curr_frac_addr   = emu_voice->addr.fract_address;
+            continue;
+        }
+
         for (pos = emu8k->pos; pos < wavetable_pos_global; pos++) {
             int32_t dat;
 
@@ -1869,7 +1888,7 @@ emu8k_update(emu8k_t *emu8k)
 
 #endif
                 }
-                if ((emu8k->hwcf3 & 0x04) && !CCCA_DMA_ACTIVE(emu_voice->ccca)) {
+                if (audible) {
                     /*volume and pan*/
                     dat = (dat * emu_voice->cvcf_curr_volume) >> 16;
 
@@ -1124,6 +1124,16 @@ gus_update(gus_t *gus)
     }
 }
 
+/* One output sample per call, all 32 voices.  The voice state is
+   already laid out as per-voice arrays (ctrl[]/cur[]/freq[]/rcur[]
+   and friends), so the remaining cost is the work itself, and it
+   resists blocking: wave and ramp IRQs must be raised on the exact
+   sample where a voice crosses its loop boundary, because module
+   players sit in those IRQ handlers re-pointing the voice before the
+   next sample.  Rendering 64 samples ahead would mean speculating
+   past an arbitrary number of such reprogramming points and rolling
+   back - more machinery than the loop it replaces.  Inactive voices
+   cost two flag tests, so light use is already cheap. */
 void
 gus_poll_wave(void *priv)
 {
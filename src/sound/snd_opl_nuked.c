@@ -67,6 +67,20 @@
 #define OPL_QUIRK_CHANNELSAMPLEDELAY (!OPL_ENABLE_STEREOEXT)
 #endif
 
+/* The channel mixing loops mask each channel's accumulator with its output
+   enable masks and sum the results, which maps directly onto integer SIMD
+   lanes. The stereo extension replaces the masks with panning multiplies
+   and keeps the scalar path. */
+#if !OPL_ENABLE_STEREOEXT && defined(__SSE2__)
+#    include <emmintrin.h>
+#    define OPL_SIMD_MIX 1
+#elif !OPL_ENABLE_STEREOEXT && defined(__ARM_NEON)
+#    include <arm_neon.h>
+#    define OPL_SIMD_MIX 1
+#else
+#    define OPL_SIMD_MIX 0
+#endif
+
 #define RSM_FRAC    10
 
 // Channel types
@@ -948,6 +962,19 @@ OPL3_ChannelUpdateAlg(opl3_channel *channel)
         OPL3_ChannelSetupAlg(channel);
 }
 
+/* Mirror the output enable masks into the flat per-channel arrays read by
+   the SIMD mixing loops. */
+static void
+OPL3_ChannelUpdateMasks(opl3_channel *channel)
+{
+    opl3_chip *chip = channel->chip;
+
+    chip->chmask[0][channel->ch_num] = (int16_t) channel->cha;
+    chip->chmask[1][channel->ch_num] = (int16_t) channel->chb;
+    chip->chmask[2][channel->ch_num] = (int16_t) channel->chc;
+    chip->chmask[3][channel->ch_num] = (int16_t) channel->chd;
+}
+
 static void
 OPL3_ChannelWriteC0(opl3_channel *channel, uint8_t data)
 {
@@ -966,6 +993,8 @@ OPL3_ChannelWriteC0(opl3_channel *channel, uint8_t data)
         channel->chc = channel->chd = 0;
     }
 
+    OPL3_ChannelUpdateMasks(channel);
+
 #if OPL_ENABLE_STEREOEXT
     if (!channel->chip->stereoext) {
         channel->leftpan  = channel->cha << 16;
@@ -1056,6 +1085,41 @@ OPL3_ProcessSlot(opl3_slot *slot)
     OPL3_SlotGenerate(slot);
 }
 
+#if OPL_SIMD_MIX
+/* Sum accm[i] & mask[i] over all 18 channels (plus zero padding), eight
+   lanes at a time. The masked 16-bit terms are widened to 32 bits before
+   summing, exactly like the scalar accumulation. */
+static inline int32_t
+OPL3_MixMasked(const int16_t *accm, const int16_t *mask)
+{
+#if defined(__SSE2__)
+    const __m128i ones = _mm_set1_epi16(1);
+    __m128i       acc  = _mm_setzero_si128();
+
+    for (uint8_t n = 0; n < 24; n += 8) {
+        const __m128i v = _mm_and_si128(_mm_loadu_si128((const __m128i *) &accm[n]),
+                                        _mm_loadu_si128((const __m128i *) &mask[n]));
+        acc = _mm_add_epi32(acc, _mm_madd_epi16(v, ones));
+    }
+
+    acc = _mm_add_epi32(acc, _mm_srli_si128(acc, 8));
+    acc = _mm_add_epi32(acc, _mm_srli_si128(acc, 4));
+    return _mm_cvtsi128_si32(acc);
+#else
+    int32x4_t acc = vdupq_n_s32(0);
+
+    for (uint8_t n = 0; n < 24; n += 8) {
+        const int16x8_t v = vandq_s16(vld1q_s16(&accm[n]), vld1q_s16(&mask[n]));
+        acc = vaddq_s32(acc, vpaddlq_s16(v));
+    }
+
+    int32x2_t sum = vadd_s32(vget_low_s32(acc), vget_high_s32(acc));
+    sum = vpadd_s32(sum, sum);
+    return vget_lane_s32(sum, 0);
+#endif
+}
+#endif
+
 static inline void
 OPL3_Generate4Ch(void *priv, int32_t *buf4)
 {
@@ -1065,7 +1129,9 @@ OPL3_Generate4Ch(void *priv, int32_t *buf4)
     int16_t      **out;
     int32_t        mix[2];
     uint8_t        i;
+#if !OPL_SIMD_MIX
     int16_t        accm;
+#endif
     uint8_t        shift = 0;
 
     buf4[1] = chip->mixbuff[1];
@@ -1078,6 +1144,16 @@ OPL3_Generate4Ch(void *priv, int32_t *buf4)
 #endif
         OPL3_ProcessSlot(&chip->slot[i]);
 
+#if OPL_SIMD_MIX
+    for (i = 0; i < 18; i++) {
+        channel         = &chip->channel[i];
+        out             = channel->out;
+        chip->chaccm[i] = *out[0] + *out[1] + *out[2] + *out[3];
+    }
+
+    mix[0] = OPL3_MixMasked(chip->chaccm, chip->chmask[0]);
+    mix[1] = OPL3_MixMasked(chip->chaccm, chip->chmask[2]);
+#else
     mix[0] = mix[1] = 0;
 
     for (i = 0; i < 18; i++) {
@@ -1091,6 +1167,7 @@ OPL3_Generate4Ch(void *priv, int32_t *buf4)
 #endif
         mix[1] += (int16_t) (accm & channel->chc);
     }
+#endif
 
     chip->mixbuff[0] = mix[0];
     chip->mixbuff[2] = mix[1];
@@ -1108,6 +1185,16 @@ OPL3_Generate4Ch(void *priv, int32_t *buf4)
         OPL3_ProcessSlot(&chip->slot[i]);
 #endif
 
+#if OPL_SIMD_MIX
+    for (i = 0; i < 18; i++) {
+        channel         = &chip->channel[i];
+        out             = channel->out;
+        chip->chaccm[i] = *out[0] + *out[1] + *out[2] + *out[3];
+    }
+
+    mix[0] = OPL3_MixMasked(chip->chaccm, chip->chmask[1]);
+    mix[1] = OPL3_MixMasked(chip->chaccm, chip->chmask[3]);
+#else
     mix[0] = mix[1] = 0;
 
     for (i = 0; i < 18; i++) {
@@ -1121,6 +1208,7 @@ OPL3_Generate4Ch(void *priv, int32_t *buf4)
 #endif
         mix[1] += (int16_t) (accm & channel->chd);
     }
+#endif
 
     chip->mixbuff[1] = mix[0];
     chip->mixbuff[3] = mix[1];
@@ -1269,6 +1357,7 @@ OPL3_Reset(opl3_chip *chip, uint32_t samplerate)
         channel->rightpan = 0x10000;
 #endif
         channel->ch_num = channum;
+        OPL3_ChannelUpdateMasks(channel);
 
         OPL3_ChannelSetupAlg(channel);
     }
@@ -18,6 +18,7 @@
  */
 #include <math.h>
 #include <stdarg.h>
+#include <stdatomic.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -103,6 +104,42 @@ static event_t      *sound_hdd_start_event;
 static volatile int hddaudioon = 0;
 static int          hdd_thread_enable = 0;
 
+/* The finished sample blocks of the main, music and wavetable streams are
+   handed to the host audio API on a dedicated output thread, decoupled from
+   the emulator thread by a lock-free single-producer/single-consumer ring.
+   All three streams are produced by timer callbacks on the emulator thread,
+   so a single shared ring preserves their order. When the host API stalls
+   and the ring fills up, blocks are dropped instead of stalling emulation. */
+enum {
+    SOUND_BLOCK_NORMAL = 0,
+    SOUND_BLOCK_MUSIC,
+    SOUND_BLOCK_WT
+};
+
+/* MUSICBUFLEN is the largest of the three stream block lengths. */
+#define SOUND_OUT_BLOCK_MAX (MUSICBUFLEN * 2)
+/* Ring size must be a power of 2. */
+#define SOUND_OUT_RING_LEN  16
+#define SOUND_OUT_RING_MASK (SOUND_OUT_RING_LEN - 1)
+
+typedef struct {
+    int stream;
+    union {
+        float   f[SOUND_OUT_BLOCK_MAX];
+        int16_t i[SOUND_OUT_BLOCK_MAX];
+    } data;
+} sound_out_block_t;
+
+static sound_out_block_t sound_out_ring[SOUND_OUT_RING_LEN];
+static atomic_int        sound_out_head;
+static atomic_int        sound_out_tail;
+static thread_t         *sound_out_thread_h;
+static event_t          *sound_out_event;
+static event_t          *sound_out_start_event;
+static volatile int      soundouton = 0;
+
+static void sound_out_thread_init(void);
+
 static void (*filter_cd_audio)(int channel, double *buffer, void *priv) = NULL;
 static void *filter_cd_audio_p                                          = NULL;
 
@@ -534,6 +571,8 @@ sound_init(void)
         cdaudioon = 0;
 
     cd_thread_enable = available_cdrom_drives ? 1 : 0;
+
+    sound_out_thread_init();
 }
 
 void
@@ -578,6 +617,112 @@ sound_set_pc_speaker_filter(void (*filter)(int channel, double *buffer, void *pr
     }
 }
 
+static void
+sound_out_push(int stream, const void *buf, int len)
+{
+    const int head = atomic_load_explicit(&sound_out_head, memory_order_relaxed);
+    const int next = (head + 1) & SOUND_OUT_RING_MASK;
+
+    if (!soundouton)
+        return;
+
+    /* Ring full - the host audio API is behind, drop the block. */
+    if (next == atomic_load_explicit(&sound_out_tail, memory_order_acquire))
+        return;
+
+    sound_out_block_t *block = &sound_out_ring[head];
+
+    block->stream = stream;
+    if (sound_is_float)
+        memcpy(block->data.f, buf, len * sizeof(float));
+    else
+        memcpy(block->data.i, buf, len * sizeof(int16_t));
+
+    atomic_store_explicit(&sound_out_head, next, memory_order_release);
+    thread_set_event(sound_out_event);
+}
+
+static void
+sound_out_thread(UNUSED(void *param))
+{
+    thread_set_event(sound_out_start_event);
+
+    while (soundouton) {
+        thread_wait_event(sound_out_event, -1);
+        thread_reset_event(sound_out_event);
+
+        if (!soundouton)
+            break;
+
+        int tail = atomic_load_explicit(&sound_out_tail, memory_order_relaxed);
+
+        while (tail != atomic_load_explicit(&sound_out_head, memory_order_acquire)) {
+            const sound_out_block_t *block = &sound_out_ring[tail];
+            const void              *buf   = sound_is_float ? (const void *) block->data.f
+                                                            : (const void *) block->data.i;
+
+            switch (block->stream) {
+                case SOUND_BLOCK_NORMAL:
+                    givealbuffer(buf);
+                    break;
+                case SOUND_BLOCK_MUSIC:
+                    givealbuffer_music(buf);
+                    break;
+                case SOUND_BLOCK_WT:
+                    givealbuffer_wt(buf);
+                    break;
+
+                default:
+                    break;
+            }
+
+            tail = (tail + 1) & SOUND_OUT_RING_MASK;
+            atomic_store_explicit(&sound_out_tail, tail, memory_order_release);
+        }
+    }
+}
+
+static void
+sound_out_thread_init(void)
+{
+    if (!soundouton) {
+        soundouton = 1;
+
+        atomic_store(&sound_out_head, 0);
+        atomic_store(&sound_out_tail, 0);
+
+        sound_out_start_event = thread_create_event();
+        sound_out_event       = thread_create_event();
+        sound_out_thread_h    = thread_create(sound_out_thread, NULL);
+
+        thread_wait_event(sound_out_start_event, -1);
+        thread_reset_event(sound_out_start_event);
+    }
+}
+
+void
+sound_out_thread_end(void)
+{
+    if (soundouton) {
+        soundouton = 0;
+
+        thread_set_event(sound_out_event);
+        thread_wait(sound_out_thread_h);
+
+        if (sound_out_event) {
+            thread_destroy_event(sound_out_event);
+            sound_out_event = NULL;
+        }
+
+        sound_out_thread_h = NULL;
+
+        if (sound_out_start_event) {
+            thread_destroy_event(sound_out_start_event);
+            sound_out_start_event = NULL;
+        }
+    }
+}
+
 void
 sound_poll(UNUSED(void *priv))
 {
@@ -608,9 +753,9 @@ sound_poll(UNUSED(void *priv))
         }
 
         if (sound_is_float)
-            givealbuffer(outbuffer_ex);
+            sound_out_push(SOUND_BLOCK_NORMAL, outbuffer_ex, SOUNDBUFLEN * 2);
         else
-            givealbuffer(outbuffer_ex_int16);
+            sound_out_push(SOUND_BLOCK_NORMAL, outbuffer_ex_int16, SOUNDBUFLEN * 2);
 
         if (cd_thread_enable) {
             cd_buf_update--;
@@ -659,9 +804,9 @@ music_poll(UNUSED(void *priv))
         }
 
         if (sound_is_float)
-            givealbuffer_music(outbuffer_m_ex);
+            sound_out_push(SOUND_BLOCK_MUSIC, outbuffer_m_ex, MUSICBUFLEN * 2);
         else
-            givealbuffer_music(outbuffer_m_ex_int16);
+            sound_out_push(SOUND_BLOCK_MUSIC, outbuffer_m_ex_int16, MUSICBUFLEN * 2);
 
         music_pos_global = 0;
     }
@@ -695,9 +840,9 @@ wavetable_poll(UNUSED(void *priv))
         }
 
         if (sound_is_float)
-            givealbuffer_wt(outbuffer_w_ex);
+            sound_out_push(SOUND_BLOCK_WT, outbuffer_w_ex, WTBUFLEN * 2);
         else
-            givealbuffer_wt(outbuffer_w_ex_int16);
+            sound_out_push(SOUND_BLOCK_WT, outbuffer_w_ex_int16, WTBUFLEN * 2);
 
         wavetable_pos_global = 0;
     }
@@ -4,14 +4,20 @@
 #include <wchar.h>
 #include <86box/86box.h>
 #include "cpu.h"
+#include <86box/device.h>
+#include <86box/plat.h>
 #include <86box/timer.h>
 #include <86box/nv/vid_nv_rivatimer.h>
+#include <minitrace/minitrace.h>
 
 uint64_t TIMER_USEC;
 uint64_t timer_target;
 
-/*Enabled timers are stored in a linked list, with the first timer to expire at
-  the head.*/
+/*Enabled timers are stored in an intrusive pairing heap, with the first timer
+  to expire at the root. Insertion and cancellation are O(1) (cancellation
+  restructures at most one sibling list), only extracting the expired root in
+  timer_process() pays the amortized O(log n) merge pass. The old sorted
+  linked list paid an O(n) scan on every insert instead.*/
 pc_timer_t *timer_head = NULL;
 
 /* Are we initialized? */
@@ -19,59 +25,83 @@ int timer_inited = 0;
 
 static void timer_advance_ex(pc_timer_t *timer, int start);
 
+/*Merge two detached heap roots; the later-expiring one becomes the first
+  child of the other.*/
+static pc_timer_t *
+timer_heap_merge(pc_timer_t *a, pc_timer_t *b)
+{
+    if (!TIMER_LESS_THAN(a, b)) {
+        pc_timer_t *t = a;
+        a = b;
+        b = t;
+    }
+
+    b->next = a->child;
+    if (b->next)
+        b->next->prev = b;
+    b->prev  = a;
+    a->child = b;
+    return a;
+}
+
+/*Standard two-pass pairing merge of a sibling list, used when the root is
+  removed. Returns the new root, or NULL if the list was empty.*/
+static pc_timer_t *
+timer_heap_merge_pairs(pc_timer_t *first)
+{
+    pc_timer_t *paired = NULL;
+
+    if (!first)
+        return NULL;
+
+    /*First pass: merge siblings two at a time, collecting the winners in a
+      list chained through their (now free) next pointers.*/
+    while (first) {
+        pc_timer_t *a    = first;
+        pc_timer_t *b    = a->next;
+        pc_timer_t *rest = b ? b->next : NULL;
+
+        a->next = a->prev = NULL;
+        if (b) {
+            b->next = b->prev = NULL;
+            a = timer_heap_merge(a, b);
+        }
+        a->next = paired;
+        paired  = a;
+        first   = rest;
+    }
+
+    /*Second pass: fold the pairs back into a single root.*/
+    while (paired->next) {
+        pc_timer_t *a    = paired;
+        pc_timer_t *b    = a->next;
+        pc_timer_t *rest = b->next;
+
+        a->next = NULL;
+        b->next = b->prev = NULL;
+        paired       = timer_heap_merge(a, b);
+        paired->next = rest;
+    }
+    paired->prev = NULL;
+    return paired;
+}
+
 void
 timer_enable(pc_timer_t *timer)
 {
-    pc_timer_t *timer_node = timer_head;
-
     if (timer->flags & TIMER_ENABLED)
         timer_disable(timer);
 
-    if (timer->next || timer->prev)
+    if (timer->next || timer->prev || timer->child)
         fatal("timer_enable - timer->next\n");
 
     timer->flags |= TIMER_ENABLED;
 
-    /*List currently empty - add to head*/
-    if (!timer_head) {
+    if (timer_head)
+        timer_head = timer_heap_merge(timer_head, timer);
+    else
         timer_head = timer;
-        timer->next = timer->prev = NULL;
-        timer_target = timer_head->ts_integer;
-        return;
-    }
-
-    timer_node = timer_head;
-
-    while (1) {
-        /*
-           Timer expires before timer_node.
-           Add to list in front of timer_node
-         */
-        if (TIMER_LESS_THAN(timer, timer_node)) {
-            timer->next = timer_node;
-            timer->prev = timer_node->prev;
-            timer_node->prev = timer;
-            if (timer->prev)
-                timer->prev->next = timer;
-            else {
-                timer_head = timer;
-                timer_target = timer_head->ts_integer;
-            }
-            return;
-        }
-
-        /*
-           timer_node is last in the list.
-           Add timer to end of list
-         */
-        if (!timer_node->next) {
-            timer_node->next = timer;
-            timer->prev = timer_node;
-            return;
-        }
-
-        timer_node = timer_node->next;
-    }
+    timer_target = timer_head->ts_integer;
 }
 
 void
@@ -80,23 +110,35 @@ timer_disable(pc_timer_t *timer)
     if (!timer_inited || (timer == NULL) || !(timer->flags & TIMER_ENABLED))
         return;
 
-    if (!timer->next && !timer->prev && timer != timer_head) {
+    if (!timer->next && !timer->prev && !timer->child && timer != timer_head) {
         uint32_t *p = NULL;
         *p = 5;    /* Crash deliberately. */
         fatal("timer_disable(): Attempting to disable an isolated "
-              "non-head timer incorrectly marked as enabled\n");
+              "non-root timer incorrectly marked as enabled\n");
     }
 
     timer->flags &= ~TIMER_ENABLED;
     timer->in_callback = 0;
 
-    if (timer->prev)
-        timer->prev->next = timer->next;
-    else
-        timer_head = timer->next;
-    if (timer->next)
-        timer->next->prev = timer->prev;
-    timer->prev = timer->next = NULL;
+    if (timer == timer_head)
+        timer_head = timer_heap_merge_pairs(timer->child);
+    else {
+        /*Detach from the sibling list; prev points either to the previous
+          sibling or, for a first child, to the parent.*/
+        if (timer->prev->child == timer)
+            timer->prev->child = timer->next;
+        else
+            timer->prev->next = timer->next;
+        if (timer->next)
+            timer->next->prev = timer->prev;
+
+        if (timer->child)
+            timer_head = timer_heap_merge(timer_head, timer_heap_merge_pairs(timer->child));
+    }
+
+    timer->prev = timer->next = timer->child = NULL;
+    if (timer_head)
+        timer_target = timer_head->ts_integer;
 }
 
 static void
@@ -104,9 +146,8 @@ timer_remove_head(void)
 {
     if (timer_head) {
         pc_timer_t *timer = timer_head;
-        timer_head = timer->next;
-        timer_head->prev = NULL;
-        timer->next = timer->prev = NULL;
+        timer_head  = timer_heap_merge_pairs(timer->child);
+        timer->next = timer->prev = timer->child = NULL;
         timer->flags &= ~TIMER_ENABLED;
     }
 }
@@ -119,6 +160,8 @@ timer_process(void)
     if (!timer_head)
         return;
 
+    MTR_BEGIN("timer", "timer_process");
+
     while (1) {
         pc_timer_t *timer = timer_head;
 
@@ -136,31 +179,51 @@ timer_process(void)
                have a NULL callback when no operation
                is needed.
              */
-            timer->in_callback = 1;
-            timer->callback(timer->priv);
-            timer->in_callback = 0;
+#ifdef USE_INSTRUMENT
+            if (instru_enabled) {
+                uint64_t start_time = plat_timer_read();
+
+                timer->in_callback = 1;
+                timer->callback(timer->priv);
+                timer->in_callback = 0;
+
+                device_time_add(timer->priv, plat_timer_read() - start_time);
+            } else
+#endif
+            {
+                timer->in_callback = 1;
+                timer->callback(timer->priv);
+                timer->in_callback = 0;
+            }
         }
 
         num++;
     }
 
     timer_target = timer_head->ts_integer;
+
+    MTR_END("timer", "timer_process");
 }
 
-void
-timer_close(void)
+/* Set all timers' heap links to NULL so it is assured that
+   timers that are not in malloc'd structs don't keep pointing
+   to timers that may be in malloc'd structs. */
+static void
+timer_isolate_all(pc_timer_t *t)
 {
-    pc_timer_t *t = timer_head;
-    pc_timer_t *r;
-
-    /* Set all timers' prev and next to NULL so it is assured that
-       timers that are not in malloc'd structs don't keep pointing
-       to timers that may be in malloc'd structs. */
     while (t != NULL) {
-        r       = t;
-        r->prev = r->next = NULL;
-        t                 = r->next;
+        pc_timer_t *next = t->next;
+
+        timer_isolate_all(t->child);
+        t->prev = t->next = t->child = NULL;
+        t       = next;
     }
+}
+
+void
+timer_close(void)
+{
+    timer_isolate_all(timer_head);
 
     timer_head = NULL;
 
@@ -263,10 +326,24 @@ timer_on_auto(pc_timer_t *timer, double period)
         timer_stop(timer);
 }
 
+/* Rebase the timestamps of a sibling list and its subtrees to a new TSC.
+   The same offset is applied to every timer, so the heap order is
+   unaffected. */
+static void
+timer_rebase_all(pc_timer_t *timer, uint64_t new_tsc)
+{
+    while (timer) {
+        int64_t offset_from_current_tsc = (int64_t)(timer_get_ts_int(timer) - (uint64_t)tsc);
+        timer->ts_integer = new_tsc + offset_from_current_tsc;
+
+        timer_rebase_all(timer->child, new_tsc);
+        timer = timer->next;
+    }
+}
+
 void
 timer_set_new_tsc(uint64_t new_tsc)
 {
-    pc_timer_t *timer = NULL;
     /* Run timers already expired. */
 #ifdef USE_DYNAREC
     if (cpu_use_dynarec)
@@ -278,15 +355,9 @@ timer_set_new_tsc(uint64_t new_tsc)
         return;
     }
 
-    timer = timer_head;
     timer_target = new_tsc + (int64_t)(timer_get_ts_int(timer_head) - (uint64_t)tsc);
 
-    while (timer) {
-        int64_t offset_from_current_tsc = (int64_t)(timer_get_ts_int(timer) - (uint64_t)tsc);
-        timer->ts_integer = new_tsc + offset_from_current_tsc;
-
-        timer = timer->next;
-    }
+    timer_rebase_all(timer_head, new_tsc);
 
     tsc = new_tsc;
 }
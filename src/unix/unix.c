@@ -441,7 +441,34 @@ plat_mmap(size_t size, uint8_t executable)
 #else
     void *ret = mmap(0, size, PROT_READ | PROT_WRITE | (executable ? PROT_EXEC : 0), MAP_ANON | MAP_PRIVATE, -1, 0);
 #endif
-    return (ret < 0) ? NULL : ret;
+    if (ret == MAP_FAILED)
+        return NULL;
+
+#ifdef MADV_HUGEPAGE
+    /* The big consumer here is guest RAM, which every emulated memory
+       access indirects through, so huge-page backing saves host TLB
+       misses on large guests.  Advisory only: if THP is unavailable
+       the kernel ignores it.  Code-cache mappings are left on normal
+       pages, they are written in small scattered pieces. */
+    if (!executable)
+        madvise(ret, size, MADV_HUGEPAGE);
+#endif
+
+    return ret;
+}
+
+void
+plat_mmap_zero(void *ptr, size_t size)
+{
+#ifdef __linux__
+    /* On an anonymous private mapping this both rezeroes the range and
+       returns the backing pages to the host, so zeroing guest RAM also
+       drops it from RSS until the guest touches it again. Darwin's
+       MADV_DONTNEED does not guarantee zeroing, so Linux only. */
+    if (!madvise(ptr, size, MADV_DONTNEED))
+        return;
+#endif
+    memset(ptr, 0x00, size);
 }
 
 void
@@ -450,6 +477,31 @@ plat_munmap(void *ptr, size_t size)
     munmap(ptr, size);
 }
 
+void *
+plat_mmap_file(FILE *fp, uint64_t size)
+{
+    void *ret;
+
+    if (size != (uint64_t) (size_t) size)
+        return NULL;
+
+    ret = mmap(0, (size_t) size, PROT_READ | PROT_WRITE, MAP_SHARED, fileno(fp), 0);
+    if (ret == MAP_FAILED)
+        return NULL;
+
+#ifdef MADV_WILLNEED
+    (void) madvise(ret, (size_t) size, MADV_WILLNEED);
+#endif
+
+    return ret;
+}
+
+void
+plat_munmap_file(void *ptr, uint64_t size)
+{
+    munmap(ptr, (size_t) size);
+}
+
 uint64_t
 plat_timer_read(void)
 {
@@ -485,6 +537,12 @@ plat_remove(char *path)
     remove(path);
 }
 
+void
+plat_rename(char *old_path, char *new_path)
+{
+    rename(old_path, new_path);
+}
+
 void ui_sb_update_icon_state(int tag, int state)
 {
     osd_ui_sb_update_icon_state(tag, state);
@@ -100,6 +100,14 @@ ini_log(const char *fmt, ...)
 #    define ini_log(fmt, ...)
 #endif
 
+/* One-entry lookup memo: device init code resolves the same section by
+   name once per config key, so remember the last hit and validate it by
+   comparing the requested name against the section's current name (which
+   also keeps renames honest).  Deleting or closing anything must clear
+   it so it can never point at freed memory. */
+static list_t    *last_find_head = NULL;
+static section_t *last_find_sec  = NULL;
+
 static section_t *
 find_section(list_t *head, const char *name)
 {
@@ -109,9 +117,15 @@ find_section(list_t *head, const char *name)
     if (name == NULL)
         name = blank;
 
+    if ((head == last_find_head) && (last_find_sec != NULL) && !strncmp(last_find_sec->name, name, sizeof(last_find_sec->name)))
+        return last_find_sec;
+
     while (sec != NULL) {
-        if (!strncmp(sec->name, name, sizeof(sec->name)))
+        if (!strncmp(sec->name, name, sizeof(sec->name))) {
+            last_find_head = head;
+            last_find_sec  = sec;
             return sec;
+        }
 
         sec = (section_t *) sec->list.next;
     }
@@ -236,6 +250,10 @@ delete_section_if_empty(list_t *head, section_t *section)
             i_ent = (entry_t *) i_next;
         }
     } else {
+        if (section == last_find_sec) {
+            last_find_head = NULL;
+            last_find_sec  = NULL;
+        }
         list_delete(&section->list, head);
         free(section);
     }
@@ -296,6 +314,11 @@ ini_close(ini_t ini)
     if (list == NULL)
         return;
 
+    if (list == last_find_head) {
+        last_find_head = NULL;
+        last_find_sec  = NULL;
+    }
+
     sec = (section_t *) list->next;
     while (sec != NULL) {
         ns  = (section_t *) sec->list.next;
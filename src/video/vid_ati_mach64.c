@@ -3485,6 +3485,9 @@ mach64_ext_writeb(uint32_t addr, uint8_t val, void *priv)
 
             case 0x4b:
                 mach64->scaler_yuv_aper = val;
+                /* The aperture changes what linear dword writes do, so the
+                   pages promoted under the old setting must go. */
+                svga_writelookup_flush(&mach64->svga);
                 break;
 
             case 0x58:
@@ -5023,7 +5026,9 @@ mach64_readl_linear(uint32_t addr, void *priv)
 static void
 mach64_write_linear(uint32_t addr, uint8_t val, void *priv)
 {
-    svga_t *svga = (svga_t *) priv;
+    svga_t         *svga   = (svga_t *) priv;
+    const mach64_t *mach64 = (mach64_t *) svga->priv;
+
     cycles -= svga->monitor->mon_video_timing_write_b;
 
     addr &= svga->decode_mask;
@@ -5032,12 +5037,17 @@ mach64_write_linear(uint32_t addr, uint8_t val, void *priv)
     addr &= svga->vram_mask;
     svga->changedvram[addr >> 12] = svga->monitor->mon_changeframecount;
     svga->vram[addr]              = val;
+    /* Pure VRAM while the YUV scaler aperture is off - promote the page so
+       further CPU stores skip the mapping dispatch. */
+    if (!((mach64->scaler_yuv_aper >> 4) & 0xc))
+        svga_writelookup_add(svga, addr);
 }
 
 static void
 mach64_writew_linear(uint32_t addr, uint16_t val, void *priv)
 {
-    svga_t *svga = (svga_t *) priv;
+    svga_t         *svga   = (svga_t *) priv;
+    const mach64_t *mach64 = (mach64_t *) svga->priv;
 
     cycles -= svga->monitor->mon_video_timing_write_w;
 
@@ -5047,6 +5057,8 @@ mach64_writew_linear(uint32_t addr, uint16_t val, void *priv)
     addr &= svga->vram_mask;
     svga->changedvram[addr >> 12]   = svga->monitor->mon_changeframecount;
     *(uint16_t *) &svga->vram[addr] = val;
+    if (!((mach64->scaler_yuv_aper >> 4) & 0xc))
+        svga_writelookup_add(svga, addr);
 }
 
 static void
@@ -5090,6 +5102,8 @@ mach64_writel_linear(uint32_t addr, uint32_t val, void *priv)
     addr &= svga->vram_mask;
     svga->changedvram[addr >> 12]   = svga->monitor->mon_changeframecount;
     *(uint32_t *) &svga->vram[addr] = val;
+    if (!((mach64->scaler_yuv_aper >> 4) & 0xc))
+        svga_writelookup_add(svga, addr);
 }
 
 uint8_t
@@ -1023,6 +1023,62 @@ mach_accel_start(int cmd_type, int cpu_input, int count, uint32_t mix_dat, uint3
                 }
             }
 
+            /*
+               Span fast path for plain solid fills: always-1 mix, foreground
+               color source, SRC mix function, no color compare, no polygon
+               fill, full write mask, left-to-right, and every pixel inside
+               the horizontal clip window. These fills (window/desktop clears)
+               dominate the command mix, and whole rows can be laid down at
+               once instead of stepping the per-pixel state machine.
+             */
+            if (!cpu_input && (mono_src == 0) && (frgd_sel == 1) && (bkgd_sel != 3)
+                && (compare_mode == 0) && (dev->accel.frgd_mix == 0x07)
+                && ((mach->accel.dp_config & 0x12) == 0x10)
+                && (mach->accel.stepx == 1) && (mach->accel.width > 0)
+                && (dev->accel.sx == 0) && (dev->accel.sy == 0)
+                && (dev->accel.dx >= clip_l) && ((dev->accel.dx + mach->accel.width - 1) <= clip_r)
+                && ((dev->accel.dx + mach->accel.width) < 0x600)
+                && (dev->bpp ? (wrt_mask == 0xffff) : ((wrt_mask & 0xff) == 0xff))) {
+                while (dev->accel.sy < mach->accel.height) {
+                    if ((dev->accel.dy >= clip_t) && (dev->accel.dy <= clip_b)) {
+                        dev->subsys_stat |= INT_GE_BSY;
+                        if (dev->bpp) {
+                            uint32_t addr = (dev->accel.dest + dev->accel.dx) & (dev->vram_mask >> 1);
+                            for (int x = 0; x < mach->accel.width; x++) {
+                                vram_w[addr]                 = frgd_color;
+                                dev->changedvram[addr >> 11] = svga->monitor->mon_changeframecount;
+                                addr                         = (addr + 1) & (dev->vram_mask >> 1);
+                            }
+                        } else {
+                            uint32_t addr = (dev->accel.dest + dev->accel.dx) & dev->vram_mask;
+                            if ((addr + mach->accel.width) <= (dev->vram_mask + 1)) {
+                                memset(&dev->vram[addr], frgd_color, mach->accel.width);
+                                for (uint32_t page = addr >> 12; page <= ((addr + mach->accel.width - 1) >> 12); page++)
+                                    dev->changedvram[page] = svga->monitor->mon_changeframecount;
+                            } else {
+                                for (int x = 0; x < mach->accel.width; x++) {
+                                    dev->vram[addr]              = frgd_color;
+                                    dev->changedvram[addr >> 12] = svga->monitor->mon_changeframecount;
+                                    addr                         = (addr + 1) & dev->vram_mask;
+                                }
+                            }
+                        }
+                    }
+                    dev->accel.dy += mach->accel.stepy;
+                    dev->accel.sy++;
+                    dev->accel.dest = mach->accel.dst_ge_offset + (dev->accel.dy * mach->accel.dst_pitch);
+                }
+
+                /* The pattern index still advances once per pixel. */
+                mach->accel.color_pattern_idx = (mach->accel.color_pattern_idx + (mach->accel.width * mach->accel.height)) % (mach->accel.patt_len + 1);
+
+                dev->fifo_idx       = 0;
+                dev->accel.cmd_back = 1;
+                dev->accel.cur_x    = dev->accel.dx;
+                dev->accel.cur_y    = dev->accel.dy;
+                return;
+            }
+
             while (count--) {
                 switch (mono_src) {
                     case 0:
@@ -76,13 +76,16 @@ volatile double mode_hue;
 volatile double min_v;
 volatile double max_v;
 
-volatile double video_ri;
-volatile double video_rq;
-volatile double video_gi;
-volatile double video_gq;
-volatile double video_bi;
-volatile double video_bq;
-volatile int    video_sharpness;
+/* These hold integer values (see the casts in update_cga16_color()); keeping
+   them as int makes the per-pixel filter in Composite_Process() all-integer
+   instead of converting and multiplying through double six times per pixel. */
+static volatile int video_ri;
+static volatile int video_rq;
+static volatile int video_gi;
+static volatile int video_gq;
+static volatile int video_bi;
+static volatile int video_bq;
+static volatile int video_sharpness;
 
 static bool new_cga = 0;
 
@@ -1411,6 +1411,35 @@ advance:
 
 void chips_69000_bitblt_write(chips_69000_t* chips, uint8_t data);
 
+/* Check that a blit row of len bytes lies entirely inside plain VRAM, i.e.
+   it does not touch the BitBLT MMIO alias at bit 22 and does not wrap the
+   aperture, decode or VRAM masks. On success the VRAM offset of the row is
+   returned through vram_addr. */
+static int
+chips_69000_blit_row_in_vram(chips_69000_t *chips, uint32_t addr, uint32_t len, uint32_t *vram_addr)
+{
+    const svga_t *svga = &chips->svga;
+    uint32_t      last = addr + len - 1;
+
+    if ((addr | last) & 0x400000)
+        return 0;
+
+    addr &= 0x1FFFFF;
+    last &= 0x1FFFFF;
+    addr &= svga->decode_mask;
+    last &= svga->decode_mask;
+    if ((last != (addr + len - 1)) || (last >= svga->vram_max))
+        return 0;
+
+    addr &= svga->vram_mask;
+    last &= svga->vram_mask;
+    if (last != (addr + len - 1))
+        return 0;
+
+    *vram_addr = addr;
+    return 1;
+}
+
 void
 chips_69000_setup_bitblt(chips_69000_t* chips)
 {
@@ -1584,6 +1613,85 @@ chips_69000_setup_bitblt(chips_69000_t* chips)
         return;
     }
 
+    /* Fast paths for the two blits drivers issue constantly: plain
+       screen-to-screen copies (ROP 0xCC) and solid fills (ROP 0xF0 with
+       the solid monochrome pattern). In both cases the per-pixel machinery
+       below degenerates to a row-wide copy or fill - SRCCOPY never
+       consults the pattern and PATCOPY with a solid pattern writes one
+       constant - so do each row in one go instead of several linear-space
+       accesses per byte. Anything with colour keying, pattern
+       transparency, reverse X stepping or rows leaving plain VRAM keeps
+       the exact per-pixel path. */
+    if ((chips->bitblt_running.x_dir == 1) && chips->svga.fast
+        && !(chips->bitblt_running.bitblt.bitblt_control & (1 << 14))
+        && (chips->bitblt_running.actual_destination_width > 0)
+        && (chips->bitblt_running.actual_destination_height > 0)) {
+        uint8_t  rop       = chips->bitblt_running.bitblt.bitblt_control & 0xFF;
+        uint32_t row_bytes = chips->bitblt_running.actual_destination_width * chips->bitblt_running.bytes_per_pixel;
+        int      is_copy   = (rop == 0xCC) && !(chips->bitblt_running.bitblt.bitblt_control & (1 << 18));
+        int      is_fill   = (rop == 0xF0)
+            && (chips->bitblt_running.bitblt.bitblt_control & (1 << 18))
+            && (chips->bitblt_running.bitblt.bitblt_control & (1 << 19))
+            && !(chips->bitblt_running.bitblt.bitblt_control & (1 << 17));
+
+        if (is_copy || is_fill) {
+            svga_t *svga    = &chips->svga;
+            int     rows_ok = 1;
+            int     row;
+
+            for (row = 0; rows_ok && (row < chips->bitblt_running.actual_destination_height); row++) {
+                int      y = row * chips->bitblt_running.y_dir;
+                uint32_t src_vram;
+                uint32_t dst_vram;
+
+                if (!chips_69000_blit_row_in_vram(chips, chips->bitblt_running.bitblt.destination_addr + (y * chips->bitblt_running.bitblt.destination_span), row_bytes, &dst_vram))
+                    rows_ok = 0;
+                else if (is_copy) {
+                    if (!chips_69000_blit_row_in_vram(chips, chips->bitblt_running.bitblt.source_addr + (y * chips->bitblt.source_span), row_bytes, &src_vram))
+                        rows_ok = 0;
+                    /* A forward copy onto its own row smears pixel by pixel
+                       on real hardware; memmove would not, so punt. */
+                    else if ((src_vram < dst_vram) && ((src_vram + row_bytes) > dst_vram))
+                        rows_ok = 0;
+                }
+            }
+
+            if (rows_ok) {
+                /* Solid monochrome pattern with no write-masking resolves
+                   every pixel to the background colour. */
+                uint32_t fill_pixel = chips->bitblt_running.bitblt.pattern_source_key_bg;
+
+                for (row = 0; row < chips->bitblt_running.actual_destination_height; row++) {
+                    int      y = row * chips->bitblt_running.y_dir;
+                    uint32_t src_vram = 0;
+                    uint32_t dst_vram = 0;
+                    uint32_t page;
+
+                    chips_69000_blit_row_in_vram(chips, chips->bitblt_running.bitblt.destination_addr + (y * chips->bitblt_running.bitblt.destination_span), row_bytes, &dst_vram);
+
+                    if (is_copy) {
+                        chips_69000_blit_row_in_vram(chips, chips->bitblt_running.bitblt.source_addr + (y * chips->bitblt.source_span), row_bytes, &src_vram);
+                        memmove(&svga->vram[dst_vram], &svga->vram[src_vram], row_bytes);
+                    } else if (chips->bitblt_running.bytes_per_pixel == 1)
+                        memset(&svga->vram[dst_vram], fill_pixel & 0xFF, row_bytes);
+                    else {
+                        uint32_t i;
+
+                        for (i = 0; i < row_bytes; i++)
+                            svga->vram[dst_vram + i] = (fill_pixel >> (8 * (i % chips->bitblt_running.bytes_per_pixel))) & 0xFF;
+                    }
+
+                    for (page = dst_vram >> 12; page <= ((dst_vram + row_bytes - 1) >> 12); page++)
+                        svga->changedvram[page] = svga->monitor->mon_changeframecount;
+                }
+
+                cycles = orig_cycles;
+                chips_69000_bitblt_interrupt(chips);
+                return;
+            }
+        }
+    }
+
     do {
         do {
             uint32_t pixel = 0;
@@ -217,8 +217,9 @@ ega_render_graphics(ega_t *ega)
     const bool    crtcreset   = ((ega->crtc[0x17] & 0x80) == 0);
     const bool    seq9dot       = ((ega->seqregs[1] & 1) == 0);
     const bool    seqoddeven  = ((ega->seqregs[1] & 4) != 0);
-    const uint8_t blinkmask   = (attrblink ? 0x8 : 0x0);
-    const uint8_t blinkval    = (attrblink && blinked ? 0x8 : 0x0);
+    const uint32_t planemask  = 0x11111111 * (uint32_t) (ega->plane_mask);
+    const uint32_t blinkmask  = (attrblink ? 0x88888888 : 0x00000000);
+    const uint32_t blinkval   = (attrblink && blinked ? 0x88888888 : 0x00000000);
     uint32_t     *p           = &buffer32->line[ega->displine + ega->y_add][ega->x_add];
     const int     dwshift     = doublewidth ? 1 : 0;
     const int     dotwidth    = 1 << dwshift;
@@ -265,24 +266,25 @@ ega_render_graphics(ega_t *ega)
         }
 
         if (!crtcreset) {
-            for (int i = 0; i < 8; i += 2) {
-                const int outoffs = i << dwshift;
-                const int inshift = 6 - i;
-                uint8_t   dat     = (edatlookup[(edat[0] >> inshift) & 3][(edat[1] >> inshift) & 3])
-                    | (edatlookup[(edat[2] >> inshift) & 3][(edat[3] >> inshift) & 3] << 2);
-                // FIXME: Confirm blink behaviour is actually XOR on real hardware
-                uint32_t c0 = (dat >> 4) & 0xF;
-                uint32_t c1 = dat & 0xF;
-                c0 = ((c0 & ega->plane_mask & ~blinkmask) |
-                     ((c0 | ~ega->plane_mask) & blinkmask & blinkval)) ^ blinkmask;
-                c1 = ((c1 & ega->plane_mask & ~blinkmask) |
-                     ((c1 | ~ega->plane_mask) & blinkmask & blinkval)) ^ blinkmask;
-                uint32_t p0 = ega->pallook[ega->egapal[c0]];
-                uint32_t p1 = ega->pallook[ega->egapal[c1]];
+            /*
+               Group 4x 1bpp planar values into 4bpp chunky values, the same way
+               svga_render_indexed_gfx() does it. This is bit-exact with the old
+               per-pair edatlookup[][] extraction, just 32 bits at a time.
+             */
+            uint32_t dat = edat[0] | (edat[1] << 8) | (edat[2] << 16) | ((uint32_t) edat[3] << 24);
+            dat = (dat & 0xAA55AA55) | ((dat << 7) & 0x55005500) | ((dat >> 7) & 0x00AA00AA);
+            dat = (dat & 0xCCCC3333) | ((dat << 14) & 0x33330000) | ((dat >> 14) & 0x0000CCCC);
+
+            // FIXME: Confirm blink behaviour is actually XOR on real hardware
+            dat = ((dat & planemask & ~blinkmask) | ((dat | ~planemask) & blinkmask & blinkval)) ^ blinkmask;
+
+            /* Leftmost pixel first: nibbles 7, 5, 3, 1, 6, 4, 2, 0. */
+            uint32_t current_shift = (002461357) << 2;
+            for (int i = 0; i < 8; i++) {
+                const uint32_t col = ega->pallook[ega->egapal[(dat >> (current_shift & 0x1C)) & 0xF]];
+                current_shift >>= 3;
                 for (int subx = 0; subx < dotwidth; subx++)
-                    p[outoffs + subx] = p0;
-                for (int subx = 0; subx < dotwidth; subx++)
-                    p[outoffs + subx + dotwidth] = p1;
+                    p[(i << dwshift) + subx] = col;
             }
         } else
             memset(p, 0x00, charwidth * sizeof(uint32_t));
@@ -3309,6 +3309,134 @@ bitop(uint32_t src, uint32_t dst, uint32_t dwgctrl)
     return 0;
 }
 
+/* Row-span fast path for the screen-to-screen BITBLT case: plain SRC bitop,
+   no pattern, no colour key and no transparency stipple, which is the bulk
+   of GDI blit traffic on high-colour desktops.  Copies one scanline with
+   memmove() instead of per-pixel, provided the row decodes flat (inside the
+   clip rectangle, no VRAM wrap, and no overlap that a forward pixel-by-pixel
+   copy would resolve differently).  Advances src_addr and the AR registers
+   exactly like the per-pixel loop; returns 0 to make the caller fall back. */
+static int
+blit_bitblt_fast_row(mystique_t *mystique, uint32_t *src_addr_p, int16_t x_start, int16_t x_end)
+{
+    svga_t  *svga = &mystique->svga;
+    uint32_t n_x  = (uint32_t) (x_end - x_start) + 1;
+    uint32_t diff = mystique->dwgreg.ar[0] - *src_addr_p;
+    uint32_t n    = (diff < n_x) ? (diff + 1) : n_x;
+    uint32_t src_base;
+    uint32_t dst_base;
+    uint32_t mask;
+    int      shift;
+
+    if ((x_start < mystique->dwgreg.cxleft) || (x_end > mystique->dwgreg.cxright)
+        || (mystique->dwgreg.ydst_lin < mystique->dwgreg.ytop) || (mystique->dwgreg.ydst_lin > mystique->dwgreg.ybot))
+        return 0;
+
+    switch (mystique->maccess_running & MACCESS_PWIDTH_MASK) {
+        case MACCESS_PWIDTH_8:
+            mask  = mystique->vram_mask;
+            shift = 0;
+            break;
+        case MACCESS_PWIDTH_16:
+            mask  = mystique->vram_mask_w;
+            shift = 1;
+            break;
+        case MACCESS_PWIDTH_32:
+            mask  = mystique->vram_mask_l;
+            shift = 2;
+            break;
+        default:
+            return 0;
+    }
+
+    src_base = *src_addr_p & mask;
+    dst_base = (mystique->dwgreg.ydst_lin + x_start) & mask;
+
+    if (((src_base + n - 1) > mask) || ((dst_base + n - 1) > mask))
+        return 0;
+    if ((dst_base > src_base) && (dst_base < (src_base + n)))
+        return 0;
+
+    memmove(&svga->vram[dst_base << shift], &svga->vram[src_base << shift], (size_t) n << shift);
+
+    for (uint32_t page = (dst_base << shift) >> 12; page <= ((((dst_base + n) << shift) - 1) >> 12); page++)
+        svga->changedvram[page] = changeframecount;
+
+    if (diff < n_x) {
+        mystique->dwgreg.ar[0] += mystique->dwgreg.ar[5];
+        mystique->dwgreg.ar[3] += mystique->dwgreg.ar[5];
+        *src_addr_p = mystique->dwgreg.ar[3];
+    } else
+        *src_addr_p += n;
+
+    return 1;
+}
+
+/* Row-span fast path for solid trapezoid fills (the rectangle fill GDI
+   issues constantly): when the pattern row is all ones the whole span takes
+   fcol, so it can be filled flat instead of per-pixel.  Same flat-decode
+   requirements as the BITBLT fast row; returns 0 to fall back. */
+static int
+blit_trap_fast_row(mystique_t *mystique, int16_t x_l, int len, int yoff)
+{
+    svga_t  *svga = &mystique->svga;
+    uint32_t base;
+    uint32_t mask;
+    int      shift;
+
+    if ((len <= 0) || (x_l < mystique->dwgreg.cxleft) || ((x_l + len - 1) > mystique->dwgreg.cxright)
+        || (mystique->dwgreg.ydst_lin < mystique->dwgreg.ytop) || (mystique->dwgreg.ydst_lin > mystique->dwgreg.ybot))
+        return 0;
+
+    for (int x = 0; x < 16; x++) {
+        if (!mystique->dwgreg.pattern[yoff][x])
+            return 0;
+    }
+
+    switch (mystique->maccess_running & MACCESS_PWIDTH_MASK) {
+        case MACCESS_PWIDTH_8:
+            mask  = mystique->vram_mask;
+            shift = 0;
+            break;
+        case MACCESS_PWIDTH_16:
+            mask  = mystique->vram_mask_w;
+            shift = 1;
+            break;
+        case MACCESS_PWIDTH_32:
+            mask  = mystique->vram_mask_l;
+            shift = 2;
+            break;
+        default:
+            return 0;
+    }
+
+    base = (mystique->dwgreg.ydst_lin + x_l) & mask;
+    if ((base + len - 1) > mask)
+        return 0;
+
+    switch (shift) {
+        case 0:
+            memset(&svga->vram[base], mystique->dwgreg.fcol & 0xff, len);
+            break;
+        case 1:
+            for (int x = 0; x < len; x++)
+                ((uint16_t *) svga->vram)[base + x] = mystique->dwgreg.fcol & 0xffff;
+            break;
+        case 2:
+            for (int x = 0; x < len; x++)
+                ((uint32_t *) svga->vram)[base + x] = mystique->dwgreg.fcol;
+            break;
+
+        default:
+            break;
+    }
+
+    for (uint32_t page = (base << shift) >> 12; page <= ((((base + len) << shift) - 1) >> 12); page++)
+        svga->changedvram[page] = changeframecount;
+
+    return 1;
+}
+
 static uint16_t
 dither(mystique_t *mystique, int r, int g, int b, int x, int y)
 {
@@ -4808,6 +4936,9 @@ blit_trap(mystique_t *mystique)
                 else
                     len = x_r - x_l;
 
+                if ((trans_sel == 0) && blit_trap_fast_row(mystique, x_l, len, yoff))
+                    len = 0;
+
                 while (len > 0) {
                     if (x_l >= mystique->dwgreg.cxleft && x_l <= mystique->dwgreg.cxright && mystique->dwgreg.ydst_lin >= mystique->dwgreg.ytop && mystique->dwgreg.ydst_lin <= mystique->dwgreg.ybot && trans[x_l & 3]) {
                         int      xoff    = (mystique->dwgreg.xoff + (x_l & 7)) & 15;
@@ -5618,6 +5749,7 @@ blit_bitblt(mystique_t *mystique)
     svga_t   *svga = &mystique->svga;
     uint32_t  src_addr;
     int       y;
+    int       copy_fast = 0;
     int       x_dir     = mystique->dwgreg.sgn.scanleft ? -1 : 1;
     int16_t   x_start   = mystique->dwgreg.sgn.scanleft ? mystique->dwgreg.fxright : mystique->dwgreg.fxleft;
     int16_t   x_end     = mystique->dwgreg.sgn.scanleft ? mystique->dwgreg.fxleft : mystique->dwgreg.fxright;
@@ -5925,11 +6057,16 @@ blit_bitblt(mystique_t *mystique)
                 case DWGCTRL_BLTMOD_BU32RGB:
                     src_addr = mystique->dwgreg.ar[3];
 
+                    copy_fast = !(mystique->dwgreg.dwgctrl_running & (DWGCTRL_PATTERN | DWGCTRL_TRANSC))
+                        && ((mystique->dwgreg.dwgctrl_running & DWGCTRL_BOP_MASK) == BOP(0xc))
+                        && (trans_sel == 0) && (x_dir == 1) && (x_start <= x_end);
+
                     for (y = 0; y < mystique->dwgreg.length; y++) {
                         uint8_t const *const trans        = &trans_masks[trans_sel][(mystique->dwgreg.selline & 3) * 4];
                         uint32_t             old_src_addr = src_addr;
                         int16_t              x            = x_start;
 
+                        if (!(copy_fast && blit_bitblt_fast_row(mystique, &src_addr, x_start, x_end)))
                         while (1) {
                             if (x >= mystique->dwgreg.cxleft && x <= mystique->dwgreg.cxright && mystique->dwgreg.ydst_lin >= mystique->dwgreg.ytop && mystique->dwgreg.ydst_lin <= mystique->dwgreg.ybot && trans[x & 3]) {
                                 uint32_t src;
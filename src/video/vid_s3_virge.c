@@ -1914,8 +1914,6 @@ s3_virge_queue(virge_t *virge, uint32_t addr, uint32_t val, uint32_t type)
 
     virge->fifo_write_idx++;
 
-    if (FIFO_ENTRIES > 0xe000)
-        wake_fifo_thread(virge);
     if (FIFO_ENTRIES > 0xe000 || FIFO_ENTRIES < 8)
         wake_fifo_thread(virge);
 }
@@ -3056,41 +3054,40 @@ s3_virge_mmio_write_l(uint32_t addr, uint32_t val, void *priv)
         }                                                                        \
     } while (0)
 
-static void
-s3_virge_bitblt(virge_t *virge, int count, uint32_t cpu_dat)
+/* As with tri_common() below, this is expanded once per framebuffer format
+   through the s3_virge_bitblt_*bpp() wrappers so the READ/WRITE macros
+   lose their per-pixel depth switches. */
+__attribute__((always_inline)) static inline void
+s3_virge_bitblt_common(virge_t *virge, int count, uint32_t cpu_dat, const int bpp)
 {
     uint8_t  *vram = virge->svga.vram;
     uint32_t  mono_pattern[64];
     int       count_mask;
     int       x_inc = (virge->s3d.cmd_set & CMD_SET_XP) ? 1 : -1;
     int       y_inc = (virge->s3d.cmd_set & CMD_SET_YP) ? 1 : -1;
-    int       bpp;
     int       x_mul;
     int       cpu_dat_shift;
     uint32_t *pattern_data;
     uint32_t  src_fg_clr;
     uint32_t  src_bg_clr;
 
-    switch (virge->s3d.cmd_set & CMD_SET_FORMAT_MASK) {
-        case CMD_SET_FORMAT_8:
-            bpp           = 0;
+    switch (bpp) {
+        case 0: /*8 bpp*/
             x_mul         = 1;
             cpu_dat_shift = 8;
             pattern_data  = virge->s3d.pattern_8;
             src_fg_clr    = virge->s3d.src_fg_clr & 0xff;
             src_bg_clr    = virge->s3d.src_bg_clr & 0xff;
             break;
-        case CMD_SET_FORMAT_16:
-            bpp           = 1;
+        case 1: /*16 bpp*/
             x_mul         = 2;
             cpu_dat_shift = 16;
             pattern_data  = virge->s3d.pattern_16;
             src_fg_clr    = virge->s3d.src_fg_clr & 0xffff;
             src_bg_clr    = virge->s3d.src_bg_clr & 0xffff;
             break;
-        case CMD_SET_FORMAT_24:
+        case 2: /*24 bpp*/
         default:
-            bpp           = 2;
             x_mul         = 3;
             cpu_dat_shift = 24;
             pattern_data  = virge->s3d.pattern_24;
@@ -3412,6 +3409,41 @@ skip_line:
     }
 }
 
+static void
+s3_virge_bitblt_8bpp(virge_t *virge, int count, uint32_t cpu_dat)
+{
+    s3_virge_bitblt_common(virge, count, cpu_dat, 0);
+}
+
+static void
+s3_virge_bitblt_16bpp(virge_t *virge, int count, uint32_t cpu_dat)
+{
+    s3_virge_bitblt_common(virge, count, cpu_dat, 1);
+}
+
+static void
+s3_virge_bitblt_24bpp(virge_t *virge, int count, uint32_t cpu_dat)
+{
+    s3_virge_bitblt_common(virge, count, cpu_dat, 2);
+}
+
+static void
+s3_virge_bitblt(virge_t *virge, int count, uint32_t cpu_dat)
+{
+    switch (virge->s3d.cmd_set & CMD_SET_FORMAT_MASK) {
+        case CMD_SET_FORMAT_8:
+            s3_virge_bitblt_8bpp(virge, count, cpu_dat);
+            break;
+        case CMD_SET_FORMAT_16:
+            s3_virge_bitblt_16bpp(virge, count, cpu_dat);
+            break;
+        case CMD_SET_FORMAT_24:
+        default:
+            s3_virge_bitblt_24bpp(virge, count, cpu_dat);
+            break;
+    }
+}
+
 #define RGB15_TO_24(val, r, g, b)                           \
         b = ((val & 0x001f) << 3) | ((val & 0x001f) >> 2);  \
         g = ((val & 0x03e0) >> 2) | ((val & 0x03e0) >> 7);  \
@@ -4113,14 +4145,16 @@ dest_pixel_lit_texture_modulate(s3d_state_t *state)
         state->dest_rgba.a = a;
 }
 
-static void
-tri(virge_t *virge, s3d_t *s3d_tri, s3d_state_t *state, int yc, int32_t dx1, int32_t dx2)
+/* The span loop below is expanded once per destination depth so that the
+   per-pixel bpp switches constant-fold away; keep it inline-only and call
+   it through the tri_*bpp() wrappers. */
+__attribute__((always_inline)) static inline void
+tri_common(virge_t *virge, s3d_t *s3d_tri, s3d_state_t *state, int yc, int32_t dx1, int32_t dx2, const int bpp)
 {
     uint8_t *vram    = virge->svga.vram;
     int      x_dir   = s3d_tri->tlr ? 1 : -1;
     int      use_z   = !(s3d_tri->cmd_set & CMD_SET_ZB_MODE);
     int      y_count = yc;
-    int      bpp     = (s3d_tri->cmd_set >> 2) & 7;
     uint32_t dest_offset;
     uint32_t z_offset;
 
@@ -4344,6 +4378,31 @@ tri_skip_line:
     }
 }
 
+static void
+tri_8bpp(virge_t *virge, s3d_t *s3d_tri, s3d_state_t *state, int yc, int32_t dx1, int32_t dx2)
+{
+    tri_common(virge, s3d_tri, state, yc, dx1, dx2, 0);
+}
+
+static void
+tri_16bpp(virge_t *virge, s3d_t *s3d_tri, s3d_state_t *state, int yc, int32_t dx1, int32_t dx2)
+{
+    tri_common(virge, s3d_tri, state, yc, dx1, dx2, 1);
+}
+
+static void
+tri_24bpp(virge_t *virge, s3d_t *s3d_tri, s3d_state_t *state, int yc, int32_t dx1, int32_t dx2)
+{
+    tri_common(virge, s3d_tri, state, yc, dx1, dx2, 2);
+}
+
+/* Reserved destination format encodings keep the old runtime-bpp behaviour. */
+static void
+tri_generic(virge_t *virge, s3d_t *s3d_tri, s3d_state_t *state, int yc, int32_t dx1, int32_t dx2)
+{
+    tri_common(virge, s3d_tri, state, yc, dx1, dx2, (s3d_tri->cmd_set >> 2) & 7);
+}
+
 static int tex_size[8] = { 4 * 2, 2 * 2, 2 * 2, 1 * 2, 2 / 1, 2 / 1, 1 * 2, 1 * 2 };
 
 static void
@@ -4351,6 +4410,8 @@ s3_virge_triangle(virge_t *virge, s3d_t *s3d_tri)
 {
     s3d_state_t state;
 
+    void (*tri)(virge_t *virge, s3d_t *s3d_tri, s3d_state_t *state, int yc, int32_t dx1, int32_t dx2);
+
     uint32_t tex_base;
     int      c;
 
@@ -4383,6 +4444,21 @@ s3_virge_triangle(virge_t *virge, s3d_t *s3d_tri)
             tex_base += ((1 << (c * 2)) * tex_size[(s3d_tri->cmd_set >> 5) & 7]) / 2;
     }
 
+    switch ((s3d_tri->cmd_set >> 2) & 7) {
+        case 0: /*8 bpp*/
+            tri = tri_8bpp;
+            break;
+        case 1: /*16 bpp*/
+            tri = tri_16bpp;
+            break;
+        case 2: /*24 bpp*/
+            tri = tri_24bpp;
+            break;
+        default:
+            tri = tri_generic;
+            break;
+    }
+
     switch ((s3d_tri->cmd_set >> 27) & 0xf) {
         case 0:
             dest_pixel = dest_pixel_gouraud_shaded_triangle;
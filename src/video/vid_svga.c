@@ -35,6 +35,8 @@
 #include <86box/mem.h>
 #include <86box/rom.h>
 #include <86box/plat.h>
+#include <minitrace/minitrace.h>
+#include <86box/thread.h>
 #include <86box/ui.h>
 #include <86box/video.h>
 #include <86box/vid_8514a.h>
@@ -46,6 +48,8 @@
 void svga_doblit(int wx, int wy, svga_t *svga);
 void svga_poll(void *priv);
 
+int svga_deferred_render = 0;
+
 svga_t *svga_8514;
 
 extern int     cyc_total;
@@ -331,6 +335,8 @@ svga_out(uint16_t addr, uint8_t val, void *priv)
                     svga->fast         = (svga->gdcreg[8] == 0xff && !(svga->gdcreg[3] & 0x18) && !svga->gdcreg[1]) &&
                                         ((svga->chain4 && (svga->packed_chain4 || svga->force_old_addr)) || svga->fb_only) &&
                                         !(svga->adv_flags & FLAG_ADDR_BY8);
+                    if (!svga->fast)
+                        svga_writelookup_flush(svga);
                     break;
 
                 default:
@@ -434,6 +440,8 @@ svga_out(uint16_t addr, uint8_t val, void *priv)
             svga->fast                       = (svga->gdcreg[8] == 0xff && !(svga->gdcreg[3] & 0x18) && !svga->gdcreg[1]) &&
                                                ((svga->chain4 && (svga->packed_chain4 || svga->force_old_addr)) || svga->fb_only) &&
                                                 !(svga->adv_flags & FLAG_ADDR_BY8);;
+            if (!svga->fast)
+                svga_writelookup_flush(svga);
             if (((svga->gdcaddr & 15) == 5 && (val ^ o) & 0x70) || ((svga->gdcaddr & 15) == 6 && (val ^ o) & 1)) {
                 svga_log("GDCADDR%02x recalc.\n", svga->gdcaddr & 0x0f);
                 svga_recalctimings(svga);
@@ -707,6 +715,10 @@ svga_recalctimings(svga_t *svga)
     int              hsyncend;
 #endif
     int              old_monitor_overscan_x = svga->monitor->mon_overscan_x;
+
+    /* Mode changes can alter the linear decode rules, so stop trusting any
+       framebuffer pages promoted into the write TLB under the old ones. */
+    svga_writelookup_flush(svga);
     int              old_monitor_overscan_y = svga->monitor->mon_overscan_y;
 
     if (svga->adv_flags & FLAG_PRECISETIME) {
@@ -1282,6 +1294,148 @@ svga_recalctimings(svga_t *svga)
     }
 }
 
+/* Deferred scanline rendering - the CPU thread captures the VRAM span of a
+   display line into a ring buffer and a worker thread performs the 15/16/32
+   bpp to 32 bpp conversion, overlapping it with emulation of the next lines.
+   The queue is drained before every blit so the frame the UI sees is always
+   complete. */
+static void
+svga_defer_thread(void *param)
+{
+    svga_t *svga = (svga_t *) param;
+
+    while (svga->defer_thread_run) {
+        thread_wait_event(svga->defer_wake_event, -1);
+        thread_reset_event(svga->defer_wake_event);
+
+        while (svga->defer_read_idx != svga->defer_write_idx) {
+            svga_defer_line_t *line = &svga->defer_lines[svga->defer_read_idx & (SVGA_DEFER_ENTRIES - 1)];
+            uint32_t          *p    = line->dst;
+            uint32_t           dat;
+
+            if (line->bpp == 32) {
+                if (!svga->lut_map) {
+                    for (int x = 0; x < line->pixels; x++)
+                        p[x] = *(uint32_t *) &line->vram[x << 2] & 0xffffff;
+                } else {
+                    for (int x = 0; x < line->pixels; x++) {
+                        dat  = *(uint32_t *) &line->vram[x << 2];
+                        p[x] = svga_lookup_lut_ram(svga, dat & 0xffffff);
+                    }
+                }
+            } else if (svga->conv_16to32 == svga_conv_16to32) {
+                const uint32_t *lut = (line->bpp == 15) ? video_15to32 : video_16to32;
+
+                for (int x = 0; x < line->pixels; x += 2) {
+                    dat      = *(uint32_t *) &line->vram[x << 1];
+                    p[x]     = lut[dat & 0xffff];
+                    p[x + 1] = lut[dat >> 16];
+                }
+            } else {
+                for (int x = 0; x < line->pixels; x += 2) {
+                    dat      = *(uint32_t *) &line->vram[x << 1];
+                    p[x]     = svga->conv_16to32(svga, dat & 0xffff, line->bpp);
+                    p[x + 1] = svga->conv_16to32(svga, dat >> 16, line->bpp);
+                }
+            }
+
+            svga->defer_read_idx++;
+            thread_set_event(svga->defer_not_full_event);
+        }
+    }
+}
+
+static void
+svga_defer_drain(svga_t *svga)
+{
+    if (!svga->defer_lines)
+        return;
+
+    while (svga->defer_read_idx != svga->defer_write_idx) {
+        thread_reset_event(svga->defer_not_full_event);
+        thread_set_event(svga->defer_wake_event);
+        if (svga->defer_read_idx != svga->defer_write_idx)
+            thread_wait_event(svga->defer_not_full_event, 1);
+    }
+}
+
+/* Try to queue the current display line for the worker thread. Returns 1 if
+   the line was captured (or provably clean), 0 if the caller must render it
+   synchronously. Only the linear 15/16/32 bpp high-res paths are handled;
+   remapped addressing, the old addressing mode and lines touched by the
+   overlay or a hardware cursor fall back to the renderer. */
+static int
+svga_defer_line(svga_t *svga)
+{
+    int                bpp;
+    int                pixels;
+    int                bytes;
+    int                first;
+    uint32_t           addr;
+    uint32_t           changed_addr;
+    svga_defer_line_t *line;
+
+    if (svga->render == svga_render_32bpp_highres)
+        bpp = 32;
+    else if (svga->render == svga_render_16bpp_highres)
+        bpp = 16;
+    else if (svga->render == svga_render_15bpp_highres)
+        bpp = 15;
+    else
+        return 0;
+
+    if (svga->force_old_addr || svga->remap_required)
+        return 0;
+    if (svga->overlay_on || svga->dac_hwcursor_on || svga->hwcursor_on)
+        return 0;
+
+    if ((svga->displine + svga->y_add) < 0)
+        return 1;
+
+    /* The 15/16 bpp renderers work in groups of 8 pixels. */
+    pixels = svga->hdisp + svga->scrollcache + 1;
+    if (bpp != 32)
+        pixels = (pixels + 7) & ~7;
+    if (pixels > SVGA_DEFER_MAX_PIXELS)
+        return 0;
+
+    changed_addr = svga->remap_func(svga, svga->memaddr);
+    if (!(svga->changedvram[changed_addr >> 12] || svga->changedvram[(changed_addr >> 12) + 1] || svga->fullchange))
+        return 1; /*Clean line - the renderer would not touch it either*/
+
+    while ((svga->defer_write_idx - svga->defer_read_idx) >= SVGA_DEFER_ENTRIES) {
+        thread_reset_event(svga->defer_not_full_event);
+        if ((svga->defer_write_idx - svga->defer_read_idx) >= SVGA_DEFER_ENTRIES)
+            thread_wait_event(svga->defer_not_full_event, 1);
+    }
+
+    line         = &svga->defer_lines[svga->defer_write_idx & (SVGA_DEFER_ENTRIES - 1)];
+    line->dst    = &svga->monitor->target_buffer->line[svga->displine + svga->y_add][svga->x_add];
+    line->bpp    = bpp;
+    line->pixels = pixels;
+
+    bytes = (bpp == 32) ? (pixels << 2) : (pixels << 1);
+    addr  = svga->memaddr & svga->vram_display_mask;
+    if ((addr + bytes) <= (svga->vram_display_mask + 1))
+        memcpy(line->vram, &svga->vram[addr], bytes);
+    else {
+        first = (svga->vram_display_mask + 1) - addr;
+        memcpy(line->vram, &svga->vram[addr], first);
+        memcpy(line->vram + first, svga->vram, bytes - first);
+    }
+
+    if (svga->firstline_draw == 2000)
+        svga->firstline_draw = svga->displine;
+    svga->lastline_draw = svga->displine;
+
+    svga->memaddr = (svga->memaddr + bytes) & svga->vram_display_mask;
+
+    svga->defer_write_idx++;
+    thread_set_event(svga->defer_wake_event);
+
+    return 1;
+}
+
 static void
 svga_do_render(svga_t *svga)
 {
@@ -1293,7 +1447,8 @@ svga_do_render(svga_t *svga)
 
     if (!svga->override) {
         svga->render_line_offset = svga->start_retrace_latch - svga->crtc[0x4];
-        svga->render(svga);
+        if (!(svga->defer_lines && svga_defer_line(svga)))
+            svga->render(svga);
     }
 
     if (svga->overlay_on) {
@@ -1542,14 +1697,24 @@ svga_poll(void *priv)
             svga->blink = (svga->blink + 1) & 0x7f;
 
             for (x = 0; x < ((svga->vram_mask + 1) >> 12); x++) {
-                if (svga->changedvram[x])
+                if (svga->changedvram[x]) {
                     svga->changedvram[x]--;
+                    svga->frame_changed = 1;
+                }
             }
 
-            if (svga->fullchange)
+            /* Throw the promoted framebuffer pages out of the write TLB, so
+               the first store of the next frame faults back through the
+               handler and refreshes the changedvram mark. */
+            svga_writelookup_flush(svga);
+
+            if (svga->fullchange) {
                 svga->fullchange--;
+                svga->frame_changed = 1;
+            }
         }
         if (svga->vc == svga->vsyncstart) {
+            MTR_INSTANT_I("video", "svga_vsync", "frame_changed", (intptr_t) svga->frame_changed);
             svga->dispon = 0;
             svga->cgastat |= 8;
             x = svga->hdisp;
@@ -1562,6 +1727,7 @@ svga_poll(void *priv)
             wx = x;
 
             if (!svga->override) {
+                svga->blit_skippable = !svga->frame_changed;
                 if (svga->vertical_linedbl) {
                     wy = (svga->lastline - svga->firstline) << 1;
                     svga->vdisp = wy + 1;
@@ -1572,6 +1738,7 @@ svga_poll(void *priv)
                     svga_doblit(wx, wy, svga);
                 }
             }
+            svga->frame_changed = 0;
 
             svga->firstline = 2000;
             svga->lastline  = 0;
@@ -1764,12 +1931,33 @@ svga_init(const device_t *info, svga_t *svga, void *priv, int memsize,
 
     svga->map8            = svga->pallook;
 
+    if (svga_deferred_render) {
+        svga->defer_lines          = calloc(SVGA_DEFER_ENTRIES, sizeof(svga_defer_line_t));
+        svga->defer_wake_event     = thread_create_event();
+        svga->defer_not_full_event = thread_create_event();
+        svga->defer_thread_run     = 1;
+        svga->defer_thread         = thread_create(svga_defer_thread, svga);
+    }
+
     return 0;
 }
 
 void
 svga_close(svga_t *svga)
 {
+    if (svga->defer_thread) {
+        svga->defer_thread_run = 0;
+        thread_set_event(svga->defer_wake_event);
+        thread_wait(svga->defer_thread);
+        thread_destroy_event(svga->defer_wake_event);
+        thread_destroy_event(svga->defer_not_full_event);
+        free(svga->defer_lines);
+        svga->defer_lines = NULL;
+    }
+
+    /* Make sure the write TLB holds no pointers into the VRAM being freed. */
+    svga_writelookup_flush(svga);
+
     free(svga->changedvram);
     free(svga->vram);
 
@@ -2138,6 +2326,10 @@ svga_doblit(int wx, int wy, svga_t *svga)
     int       j;
     int       xs_temp;
     int       ys_temp;
+    int       resized = 0;
+
+    /* Make sure every queued line has hit the buffer before it is blitted. */
+    svga_defer_drain(svga);
 
     y_add   = enable_overscan ? svga->monitor->mon_overscan_y : 0;
     x_add   = enable_overscan ? svga->monitor->mon_overscan_x : 0;
@@ -2176,6 +2368,7 @@ svga_doblit(int wx, int wy, svga_t *svga)
         /* Screen res has changed.. fix up, and let them know. */
         svga->monitor->mon_xsize = xs_temp;
         svga->monitor->mon_ysize = ys_temp;
+        resized                  = 1;
 
         if ((svga->monitor->mon_xsize > 1984) || (svga->monitor->mon_ysize > 2016)) {
             /* 2048x2048 is the biggest safe render texture, to account for overscan,
@@ -2212,12 +2405,68 @@ svga_doblit(int wx, int wy, svga_t *svga)
         }
     }
 
+    /* svga_poll flags frames during which no VRAM or register change was
+       live; the UI side then already holds an identical copy of the frame, so
+       the blit (and the full-frame copy it implies) can be skipped and idle
+       guests don't recopy an unchanged screen every vertical retrace. Callers
+       that render outside the changedvram scheme (8514/A, XGA, Banshee) never
+       set the flag. Pending screenshots are only serviced from the blit path,
+       so they force one through. */
+    if (svga->blit_skippable && !resized
+        && !video_force_resize_get_monitor(svga->monitor_index)
+        && !svga->monitor->mon_screenshots && !svga->monitor->mon_screenshots_clipboard
+        && !svga->monitor->mon_screenshots_raw && !svga->monitor->mon_screenshots_raw_clipboard) {
+        svga->blit_skippable = 0;
+
+        if (svga->vertical_linedbl)
+            svga->vertical_linedbl >>= 1;
+        return;
+    }
+    svga->blit_skippable = 0;
+
     video_blit_memtoscreen_monitor(x_start, y_start, svga->monitor->mon_xsize + x_add, svga->monitor->mon_ysize + y_add, svga->monitor_index);
 
     if (svga->vertical_linedbl)
         svga->vertical_linedbl >>= 1;
 }
 
+/* Promote the just-written linear framebuffer page into the CPU's software
+   write TLB, so that further stores from the interpreter and the dynarec hit
+   the VRAM array directly, without the mapping dispatch and page table walk
+   every access pays on the normal path.  Only flat-decoding pages qualify:
+   the caller guarantees there are no write side effects (svga->fast, no
+   address translation), and the whole page must decode in bounds.  Promoted
+   pages are evicted again at the end of the frame by svga_poll(), so the
+   changedvram mark set by the caller covers every direct store made through
+   the promotion. */
+void
+svga_writelookup_add(svga_t *svga, uint32_t vram_addr)
+{
+    if (!cpu_use_exec || (svga->writelookup_count >= (int) (sizeof(svga->writelookup_pages) / sizeof(svga->writelookup_pages[0]))))
+        return;
+
+    if (((vram_addr & ~0xfff) + 0xfff) >= svga->vram_max)
+        return;
+
+    if (page_lookup[mem_logical_addr >> 12] || (writelookup2[mem_logical_addr >> 12] != (uintptr_t) LOOKUP_INV))
+        return;
+
+    svga->writelookup_pages[svga->writelookup_count++] = mem_logical_addr;
+    addwritelookup_vram(mem_logical_addr, &svga->vram[vram_addr & ~0xfff]);
+}
+
+/* Evict every page this card promoted into the software write TLB.  Called
+   at the end of each frame and whenever the linear decode rules change, so
+   promoted pages never outlive the store semantics they were checked
+   against. */
+void
+svga_writelookup_flush(svga_t *svga)
+{
+    for (int i = 0; i < svga->writelookup_count; i++)
+        removewritelookup(svga->writelookup_pages[i]);
+    svga->writelookup_count = 0;
+}
+
 void
 svga_writeb_linear(uint32_t addr, uint8_t val, void *priv)
 {
@@ -2234,6 +2483,7 @@ svga_writeb_linear(uint32_t addr, uint8_t val, void *priv)
     addr &= svga->vram_mask;
     svga->changedvram[addr >> 12] = svga->monitor->mon_changeframecount;
     svga->vram[addr]              = val;
+    svga_writelookup_add(svga, addr);
 }
 
 void
@@ -2278,6 +2528,8 @@ svga_writew_common(uint32_t addr, uint16_t val, uint8_t linear, void *priv)
 
     svga->changedvram[addr >> 12]   = svga->monitor->mon_changeframecount;
     *(uint16_t *) &svga->vram[addr] = val;
+    if (linear)
+        svga_writelookup_add(svga, addr);
 }
 
 void
@@ -2349,6 +2601,8 @@ svga_writel_common(uint32_t addr, uint32_t val, uint8_t linear, void *priv)
 
     svga->changedvram[addr >> 12]   = svga->monitor->mon_changeframecount;
     *(uint32_t *) &svga->vram[addr] = val;
+    if (linear)
+        svga_writelookup_add(svga, addr);
 }
 
 void
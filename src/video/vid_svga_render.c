@@ -1616,22 +1616,33 @@ svga_render_15bpp_highres(svga_t *svga)
             svga->lastline_draw = svga->displine;
 
             if (!svga->remap_required) {
-                for (x = 0; x <= (svga->hdisp + svga->scrollcache); x += 8) {
-                    dat  = *(uint32_t *) (&svga->vram[(svga->memaddr + (x << 1)) & svga->vram_display_mask]);
-                    *p++ = svga->conv_16to32(svga, dat & 0xffff, 15);
-                    *p++ = svga->conv_16to32(svga, dat >> 16, 15);
-
-                    dat  = *(uint32_t *) (&svga->vram[(svga->memaddr + (x << 1) + 4) & svga->vram_display_mask]);
-                    *p++ = svga->conv_16to32(svga, dat & 0xffff, 15);
-                    *p++ = svga->conv_16to32(svga, dat >> 16, 15);
-
-                    dat  = *(uint32_t *) (&svga->vram[(svga->memaddr + (x << 1) + 8) & svga->vram_display_mask]);
-                    *p++ = svga->conv_16to32(svga, dat & 0xffff, 15);
-                    *p++ = svga->conv_16to32(svga, dat >> 16, 15);
-
-                    dat  = *(uint32_t *) (&svga->vram[(svga->memaddr + (x << 1) + 12) & svga->vram_display_mask]);
-                    *p++ = svga->conv_16to32(svga, dat & 0xffff, 15);
-                    *p++ = svga->conv_16to32(svga, dat >> 16, 15);
+                if (svga->conv_16to32 == svga_conv_16to32) {
+                    /*Default conversion - index the precomputed table directly
+                      instead of making an indirect call per pixel, which also
+                      lets the compiler unroll the loop.*/
+                    for (x = 0; x <= (svga->hdisp + svga->scrollcache); x += 2) {
+                        dat  = *(uint32_t *) (&svga->vram[(svga->memaddr + (x << 1)) & svga->vram_display_mask]);
+                        *p++ = video_15to32[dat & 0xffff];
+                        *p++ = video_15to32[dat >> 16];
+                    }
+                } else {
+                    for (x = 0; x <= (svga->hdisp + svga->scrollcache); x += 8) {
+                        dat  = *(uint32_t *) (&svga->vram[(svga->memaddr + (x << 1)) & svga->vram_display_mask]);
+                        *p++ = svga->conv_16to32(svga, dat & 0xffff, 15);
+                        *p++ = svga->conv_16to32(svga, dat >> 16, 15);
+
+                        dat  = *(uint32_t *) (&svga->vram[(svga->memaddr + (x << 1) + 4) & svga->vram_display_mask]);
+                        *p++ = svga->conv_16to32(svga, dat & 0xffff, 15);
+                        *p++ = svga->conv_16to32(svga, dat >> 16, 15);
+
+                        dat  = *(uint32_t *) (&svga->vram[(svga->memaddr + (x << 1) + 8) & svga->vram_display_mask]);
+                        *p++ = svga->conv_16to32(svga, dat & 0xffff, 15);
+                        *p++ = svga->conv_16to32(svga, dat >> 16, 15);
+
+                        dat  = *(uint32_t *) (&svga->vram[(svga->memaddr + (x << 1) + 12) & svga->vram_display_mask]);
+                        *p++ = svga->conv_16to32(svga, dat & 0xffff, 15);
+                        *p++ = svga->conv_16to32(svga, dat >> 16, 15);
+                    }
                 }
                 svga->memaddr += x << 1;
             } else {
@@ -1848,22 +1859,33 @@ svga_render_16bpp_highres(svga_t *svga)
             svga->lastline_draw = svga->displine;
 
             if (!svga->remap_required) {
-                for (x = 0; x <= (svga->hdisp + svga->scrollcache); x += 8) {
-                    dat  = *(uint32_t *) (&svga->vram[(svga->memaddr + (x << 1)) & svga->vram_display_mask]);
-                    *p++ = svga->conv_16to32(svga, dat & 0xffff, 16);
-                    *p++ = svga->conv_16to32(svga, dat >> 16, 16);
-
-                    dat  = *(uint32_t *) (&svga->vram[(svga->memaddr + (x << 1) + 4) & svga->vram_display_mask]);
-                    *p++ = svga->conv_16to32(svga, dat & 0xffff, 16);
-                    *p++ = svga->conv_16to32(svga, dat >> 16, 16);
-
-                    dat  = *(uint32_t *) (&svga->vram[(svga->memaddr + (x << 1) + 8) & svga->vram_display_mask]);
-                    *p++ = svga->conv_16to32(svga, dat & 0xffff, 16);
-                    *p++ = svga->conv_16to32(svga, dat >> 16, 16);
-
-                    dat  = *(uint32_t *) (&svga->vram[(svga->memaddr + (x << 1) + 12) & svga->vram_display_mask]);
-                    *p++ = svga->conv_16to32(svga, dat & 0xffff, 16);
-                    *p++ = svga->conv_16to32(svga, dat >> 16, 16);
+                if (svga->conv_16to32 == svga_conv_16to32) {
+                    /*Default conversion - index the precomputed table directly
+                      instead of making an indirect call per pixel, which also
+                      lets the compiler unroll the loop.*/
+                    for (x = 0; x <= (svga->hdisp + svga->scrollcache); x += 2) {
+                        dat  = *(uint32_t *) (&svga->vram[(svga->memaddr + (x << 1)) & svga->vram_display_mask]);
+                        *p++ = video_16to32[dat & 0xffff];
+                        *p++ = video_16to32[dat >> 16];
+                    }
+                } else {
+                    for (x = 0; x <= (svga->hdisp + svga->scrollcache); x += 8) {
+                        dat  = *(uint32_t *) (&svga->vram[(svga->memaddr + (x << 1)) & svga->vram_display_mask]);
+                        *p++ = svga->conv_16to32(svga, dat & 0xffff, 16);
+                        *p++ = svga->conv_16to32(svga, dat >> 16, 16);
+
+                        dat  = *(uint32_t *) (&svga->vram[(svga->memaddr + (x << 1) + 4) & svga->vram_display_mask]);
+                        *p++ = svga->conv_16to32(svga, dat & 0xffff, 16);
+                        *p++ = svga->conv_16to32(svga, dat >> 16, 16);
+
+                        dat  = *(uint32_t *) (&svga->vram[(svga->memaddr + (x << 1) + 8) & svga->vram_display_mask]);
+                        *p++ = svga->conv_16to32(svga, dat & 0xffff, 16);
+                        *p++ = svga->conv_16to32(svga, dat >> 16, 16);
+
+                        dat  = *(uint32_t *) (&svga->vram[(svga->memaddr + (x << 1) + 12) & svga->vram_display_mask]);
+                        *p++ = svga->conv_16to32(svga, dat & 0xffff, 16);
+                        *p++ = svga->conv_16to32(svga, dat >> 16, 16);
+                    }
                 }
                 svga->memaddr += x << 1;
             } else {
@@ -2137,9 +2159,18 @@ svga_render_32bpp_highres(svga_t *svga)
             svga->lastline_draw = svga->displine;
 
             if (!svga->remap_required) {
-                for (x = 0; x <= (svga->hdisp + svga->scrollcache); x++) {
-                    dat  = *(uint32_t *) (&svga->vram[(svga->memaddr + (x << 2)) & svga->vram_display_mask]);
-                    *p++ = lookup_lut(dat & 0xffffff);
+                if (!svga->lut_map) {
+                    /*No RAM LUT mapping - plain masked copy, which the
+                      compiler can vectorize.*/
+                    for (x = 0; x <= (svga->hdisp + svga->scrollcache); x++) {
+                        dat  = *(uint32_t *) (&svga->vram[(svga->memaddr + (x << 2)) & svga->vram_display_mask]);
+                        *p++ = dat & 0xffffff;
+                    }
+                } else {
+                    for (x = 0; x <= (svga->hdisp + svga->scrollcache); x++) {
+                        dat  = *(uint32_t *) (&svga->vram[(svga->memaddr + (x << 2)) & svga->vram_display_mask]);
+                        *p++ = lookup_lut(dat & 0xffffff);
+                    }
                 }
                 svga->memaddr += (x * 4);
             } else {
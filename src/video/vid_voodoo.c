@@ -438,9 +438,7 @@ voodoo_readl(uint32_t addr, void *priv)
                     int busy         = (written - voodoo->cmd_read) ||
                                (voodoo->cmdfifo_depth_rd != voodoo->cmdfifo_depth_wr) ||
                                voodoo->voodoo_busy ||
-                               voodoo->render_voodoo_busy[0] ||
-                               (voodoo->render_threads >= 2 && voodoo->render_voodoo_busy[1]) ||
-                               (voodoo->render_threads == 4 && (voodoo->render_voodoo_busy[2] || voodoo->render_voodoo_busy[3]));
+                               voodoo_render_threads_busy(voodoo);
 
                     if (SLI_ENABLED && voodoo->type != VOODOO_2) {
                         voodoo_t *voodoo_other  = (voodoo == voodoo->set->voodoos[0]) ? voodoo->set->voodoos[1] : voodoo->set->voodoos[0];
@@ -453,9 +451,7 @@ voodoo_readl(uint32_t addr, void *priv)
                         if ((other_written - voodoo_other->cmd_read) ||
                             (voodoo_other->cmdfifo_depth_rd != voodoo_other->cmdfifo_depth_wr) ||
                             voodoo_other->voodoo_busy ||
-                            voodoo_other->render_voodoo_busy[0] ||
-                            (voodoo_other->render_threads >= 2 && voodoo_other->render_voodoo_busy[1]) ||
-                            (voodoo_other->render_threads == 4 && (voodoo_other->render_voodoo_busy[2] || voodoo_other->render_voodoo_busy[3])))
+                            voodoo_render_threads_busy(voodoo_other))
                             busy = 1;
                         if (!voodoo_other->voodoo_busy)
                             voodoo_wake_fifo_thread(voodoo_other);
@@ -1219,32 +1215,20 @@ voodoo_card_init(void)
     voodoo->fbiInit0 = 0;
 
     voodoo->wake_fifo_thread         = thread_create_event();
-    voodoo->wake_render_thread[0]    = thread_create_event();
-    voodoo->wake_render_thread[1]    = thread_create_event();
-    voodoo->wake_render_thread[2]    = thread_create_event();
-    voodoo->wake_render_thread[3]    = thread_create_event();
+    for (c = 0; c < RENDER_THREADS_MAX; c++)
+        voodoo->wake_render_thread[c] = thread_create_event();
     voodoo->wake_main_thread         = thread_create_event();
     voodoo->fifo_not_full_event      = thread_create_event();
     voodoo->fifo_empty_event         = thread_create_event();
     thread_set_event(voodoo->fifo_empty_event);
     ATOMIC_STORE(voodoo->fifo_empty_signaled, 1);
-    voodoo->render_not_full_event[0] = thread_create_event();
-    voodoo->render_not_full_event[1] = thread_create_event();
-    voodoo->render_not_full_event[2] = thread_create_event();
-    voodoo->render_not_full_event[3] = thread_create_event();
+    for (c = 0; c < RENDER_THREADS_MAX; c++)
+        voodoo->render_not_full_event[c] = thread_create_event();
     voodoo->fifo_thread_run          = 1;
     voodoo->fifo_thread              = thread_create(voodoo_fifo_thread, voodoo);
-    voodoo->render_thread_run[0]     = 1;
-    voodoo->render_thread[0]         = thread_create(voodoo_render_thread_1, voodoo);
-    if (voodoo->render_threads >= 2) {
-        voodoo->render_thread_run[1] = 1;
-        voodoo->render_thread[1]     = thread_create(voodoo_render_thread_2, voodoo);
-    }
-    if (voodoo->render_threads == 4) {
-        voodoo->render_thread_run[2] = 1;
-        voodoo->render_thread[2]     = thread_create(voodoo_render_thread_3, voodoo);
-        voodoo->render_thread_run[3] = 1;
-        voodoo->render_thread[3]     = thread_create(voodoo_render_thread_4, voodoo);
+    for (c = 0; c < voodoo->render_threads; c++) {
+        voodoo->render_thread_run[c] = 1;
+        voodoo->render_thread[c]     = thread_create(voodoo_render_thread_funcs[c], voodoo);
     }
     voodoo->swap_mutex = thread_create_mutex();
     timer_add(&voodoo->wake_timer, voodoo_wake_timer, (void *) voodoo, 0);
@@ -1352,32 +1336,20 @@ voodoo_2d3d_card_init(int type)
     voodoo->fbiInit0 = 0;
 
     voodoo->wake_fifo_thread         = thread_create_event();
-    voodoo->wake_render_thread[0]    = thread_create_event();
-    voodoo->wake_render_thread[1]    = thread_create_event();
-    voodoo->wake_render_thread[2]    = thread_create_event();
-    voodoo->wake_render_thread[3]    = thread_create_event();
+    for (c = 0; c < RENDER_THREADS_MAX; c++)
+        voodoo->wake_render_thread[c] = thread_create_event();
     voodoo->wake_main_thread         = thread_create_event();
     voodoo->fifo_not_full_event      = thread_create_event();
     voodoo->fifo_empty_event         = thread_create_event();
     thread_set_event(voodoo->fifo_empty_event);
     ATOMIC_STORE(voodoo->fifo_empty_signaled, 1);
-    voodoo->render_not_full_event[0] = thread_create_event();
-    voodoo->render_not_full_event[1] = thread_create_event();
-    voodoo->render_not_full_event[2] = thread_create_event();
-    voodoo->render_not_full_event[3] = thread_create_event();
+    for (c = 0; c < RENDER_THREADS_MAX; c++)
+        voodoo->render_not_full_event[c] = thread_create_event();
     voodoo->fifo_thread_run          = 1;
     voodoo->fifo_thread              = thread_create(voodoo_fifo_thread, voodoo);
-    voodoo->render_thread_run[0]     = 1;
-    voodoo->render_thread[0]         = thread_create(voodoo_render_thread_1, voodoo);
-    if (voodoo->render_threads >= 2) {
-        voodoo->render_thread_run[1] = 1;
-        voodoo->render_thread[1]     = thread_create(voodoo_render_thread_2, voodoo);
-    }
-    if (voodoo->render_threads == 4) {
-        voodoo->render_thread_run[2] = 1;
-        voodoo->render_thread[2]     = thread_create(voodoo_render_thread_3, voodoo);
-        voodoo->render_thread_run[3] = 1;
-        voodoo->render_thread[3]     = thread_create(voodoo_render_thread_4, voodoo);
+    for (c = 0; c < voodoo->render_threads; c++) {
+        voodoo->render_thread_run[c] = 1;
+        voodoo->render_thread[c]     = thread_create(voodoo_render_thread_funcs[c], voodoo);
     }
     voodoo->swap_mutex = thread_create_mutex();
     timer_add(&voodoo->wake_timer, voodoo_wake_timer, (void *) voodoo, 0);
@@ -1510,30 +1482,19 @@ voodoo_card_close(voodoo_t *voodoo)
     voodoo->fifo_thread_run = 0;
     thread_set_event(voodoo->wake_fifo_thread);
     thread_wait(voodoo->fifo_thread);
-    voodoo->render_thread_run[0] = 0;
-    thread_set_event(voodoo->wake_render_thread[0]);
-    thread_wait(voodoo->render_thread[0]);
-    if (voodoo->render_threads >= 2) {
-        voodoo->render_thread_run[1] = 0;
-        thread_set_event(voodoo->wake_render_thread[1]);
-        thread_wait(voodoo->render_thread[1]);
-    }
-    if (voodoo->render_threads == 4) {
-        voodoo->render_thread_run[2] = 0;
-        thread_set_event(voodoo->wake_render_thread[2]);
-        thread_wait(voodoo->render_thread[2]);
-        voodoo->render_thread_run[3] = 0;
-        thread_set_event(voodoo->wake_render_thread[3]);
-        thread_wait(voodoo->render_thread[3]);
+    for (int c = 0; c < voodoo->render_threads; c++) {
+        voodoo->render_thread_run[c] = 0;
+        thread_set_event(voodoo->wake_render_thread[c]);
+        thread_wait(voodoo->render_thread[c]);
     }
     thread_destroy_event(voodoo->fifo_not_full_event);
     thread_destroy_event(voodoo->fifo_empty_event);
     thread_destroy_event(voodoo->wake_main_thread);
     thread_destroy_event(voodoo->wake_fifo_thread);
-    thread_destroy_event(voodoo->wake_render_thread[0]);
-    thread_destroy_event(voodoo->wake_render_thread[1]);
-    thread_destroy_event(voodoo->render_not_full_event[0]);
-    thread_destroy_event(voodoo->render_not_full_event[1]);
+    for (int c = 0; c < RENDER_THREADS_MAX; c++) {
+        thread_destroy_event(voodoo->wake_render_thread[c]);
+        thread_destroy_event(voodoo->render_not_full_event[c]);
+    }
 
     if (voodoo->wait_stats_enabled && voodoo->wait_stats_explicit) {
         pclog("Voodoo wait stats (type=%d): fifo_full waits=%" PRIu64 " ticks=%" PRIu64 " spins=%" PRIu64
@@ -1701,6 +1662,7 @@ static const device_config_t voodoo_config[] = {
             { .description = "1", .value = 1 },
             { .description = "2", .value = 2 },
             { .description = "4", .value = 4 },
+            { .description = "8", .value = 8 },
             { .description = ""              }
         },
         .bios           = { { 0 } }
@@ -1128,7 +1128,7 @@ banshee_status(banshee_t *banshee)
     int           fifo_entries = FIFO_ENTRIES;
     int           swap_count   = voodoo->swap_count;
     int           written      = voodoo->cmd_written + voodoo->cmd_written_fifo;
-    int           busy         = (written - voodoo->cmd_read) || (voodoo->cmdfifo_depth_rd != voodoo->cmdfifo_depth_wr) || (voodoo->cmdfifo_depth_rd_2 != voodoo->cmdfifo_depth_wr_2) || voodoo->render_voodoo_busy[0] || voodoo->render_voodoo_busy[1] || voodoo->render_voodoo_busy[2] || voodoo->render_voodoo_busy[3] || voodoo->voodoo_busy;
+    int           busy         = (written - voodoo->cmd_read) || (voodoo->cmdfifo_depth_rd != voodoo->cmdfifo_depth_wr) || (voodoo->cmdfifo_depth_rd_2 != voodoo->cmdfifo_depth_wr_2) || voodoo_render_threads_busy(voodoo) || voodoo->voodoo_busy;
     uint32_t      ret          = 0;
 
     if (fifo_entries < 0x20)
@@ -1760,7 +1760,8 @@ banshee_cmd_write(void *priv, uint32_t addr, uint32_t val)
             voodoo->cmdfifo_enabled = val & 0x100;
             if (!voodoo->cmdfifo_enabled)
                 voodoo->cmdfifo_in_sub = 0; /*Not sure exactly when this should be reset*/
-            voodoo->cmdfifo_in_agp = val & 0x200;
+            voodoo->cmdfifo_in_agp       = val & 0x200;
+            voodoo->cmdfifo_prefetch_len = 0;
 #if 0
             banshee_log("cmdfifo_base=%08x  cmdfifo_end=%08x\n", voodoo->cmdfifo_base, voodoo->cmdfifo_end);
 #endif
@@ -1773,7 +1774,8 @@ banshee_cmd_write(void *priv, uint32_t addr, uint32_t val)
 #endif
 
         case cmdRdPtrL0:
-            voodoo->cmdfifo_rp = val;
+            voodoo->cmdfifo_rp           = val;
+            voodoo->cmdfifo_prefetch_len = 0;
             break;
         case cmdAMin0:
             voodoo->cmdfifo_amin = val;
@@ -1800,7 +1802,8 @@ banshee_cmd_write(void *priv, uint32_t addr, uint32_t val)
             voodoo->cmdfifo_enabled_2 = val & 0x100;
             if (!voodoo->cmdfifo_enabled_2)
                 voodoo->cmdfifo_in_sub_2 = 0; /*Not sure exactly when this should be reset*/
-            voodoo->cmdfifo_in_agp_2 = val & 0x200;
+            voodoo->cmdfifo_in_agp_2       = val & 0x200;
+            voodoo->cmdfifo_prefetch_len_2 = 0;
 #if 0
             banshee_log("cmdfifo_base=%08x  cmdfifo_end=%08x\n", voodoo->cmdfifo_base, voodoo->cmdfifo_end);
 #endif
@@ -1813,7 +1816,8 @@ banshee_cmd_write(void *priv, uint32_t addr, uint32_t val)
 #endif
 
         case cmdRdPtrL1:
-            voodoo->cmdfifo_rp_2 = val;
+            voodoo->cmdfifo_rp_2           = val;
+            voodoo->cmdfifo_prefetch_len_2 = 0;
             break;
         case cmdAMin1:
             voodoo->cmdfifo_amin_2 = val;
@@ -2228,7 +2232,8 @@ banshee_write_linear_l(uint32_t addr, uint32_t val, void *priv)
             voodoo->cmdfifo_amin = voodoo->cmdfifo_base;
             voodoo->cmdfifo_amax = voodoo->cmdfifo_base;
             voodoo->cmdfifo_depth_wr++;
-            voodoo_wake_fifo_thread(voodoo);
+            if ((voodoo->cmdfifo_depth_wr - voodoo->cmdfifo_depth_rd) < 20)
+                voodoo_wake_fifo_thread(voodoo);
         } else if (voodoo->cmdfifo_holecount) {
 #if 0
             if ((addr <= voodoo->cmdfifo_amin && voodoo->cmdfifo_amin != -4) || addr >= voodoo->cmdfifo_amax)
@@ -2240,6 +2245,7 @@ banshee_write_linear_l(uint32_t addr, uint32_t val, void *priv)
                 /*Filled in holes, resume normal operation*/
                 voodoo->cmdfifo_depth_wr += ((voodoo->cmdfifo_amax - voodoo->cmdfifo_amin) >> 2);
                 voodoo->cmdfifo_amin = voodoo->cmdfifo_amax;
+                /*Bulk add; always wake as the pre-fill depth may have been 0*/
                 voodoo_wake_fifo_thread(voodoo);
 #if 0
                 banshee_log("hole filled! amin=%08x amax=%08x added %i words\n", voodoo->cmdfifo_amin, voodoo->cmdfifo_amax, words_to_add);
@@ -2250,7 +2256,8 @@ banshee_write_linear_l(uint32_t addr, uint32_t val, void *priv)
             voodoo->cmdfifo_amin = addr;
             voodoo->cmdfifo_amax = addr;
             voodoo->cmdfifo_depth_wr++;
-            voodoo_wake_fifo_thread(voodoo);
+            if ((voodoo->cmdfifo_depth_wr - voodoo->cmdfifo_depth_rd) < 20)
+                voodoo_wake_fifo_thread(voodoo);
         } else {
             /*Out-of-order write*/
             if (addr < voodoo->cmdfifo_amin) {
@@ -2282,7 +2289,8 @@ banshee_write_linear_l(uint32_t addr, uint32_t val, void *priv)
             voodoo->cmdfifo_amin_2 = voodoo->cmdfifo_base_2;
             voodoo->cmdfifo_amax_2 = voodoo->cmdfifo_base_2;
             voodoo->cmdfifo_depth_wr_2++;
-            voodoo_wake_fifo_thread(voodoo);
+            if ((voodoo->cmdfifo_depth_wr_2 - voodoo->cmdfifo_depth_rd_2) < 20)
+                voodoo_wake_fifo_thread(voodoo);
         } else if (voodoo->cmdfifo_holecount_2) {
 #if 0
             if ((addr <= voodoo->cmdfifo_amin && voodoo->cmdfifo_amin != -4) || addr >= voodoo->cmdfifo_amax)
@@ -2294,6 +2302,7 @@ banshee_write_linear_l(uint32_t addr, uint32_t val, void *priv)
                 /*Filled in holes, resume normal operation*/
                 voodoo->cmdfifo_depth_wr_2 += ((voodoo->cmdfifo_amax_2 - voodoo->cmdfifo_amin_2) >> 2);
                 voodoo->cmdfifo_amin_2 = voodoo->cmdfifo_amax_2;
+                /*Bulk add; always wake as the pre-fill depth may have been 0*/
                 voodoo_wake_fifo_thread(voodoo);
 #if 0
                 banshee_log("hole filled! amin=%08x amax=%08x added %i words\n", voodoo->cmdfifo_amin, voodoo->cmdfifo_amax, words_to_add);
@@ -2304,7 +2313,8 @@ banshee_write_linear_l(uint32_t addr, uint32_t val, void *priv)
             voodoo->cmdfifo_amin_2 = addr;
             voodoo->cmdfifo_amax_2 = addr;
             voodoo->cmdfifo_depth_wr_2++;
-            voodoo_wake_fifo_thread(voodoo);
+            if ((voodoo->cmdfifo_depth_wr_2 - voodoo->cmdfifo_depth_rd_2) < 20)
+                voodoo_wake_fifo_thread(voodoo);
         } else {
             /*Out-of-order write*/
             if (addr < voodoo->cmdfifo_amin_2) {
@@ -2768,6 +2778,10 @@ banshee_overlay_draw(svga_t *svga, int displine)
     unsigned int    y_coeff   = (voodoo->overlay.src_y & 0xfffff) >> 4;
     int             skip_filtering;
     const uint32_t *clut = &svga->pallook[(banshee->vidProcCfg & VIDPROCCFG_OVERLAY_CLUT_SEL) ? 256 : 0];
+    /*The enable conditions banshee_chroma_key() tests first are constant
+      across the scanline; evaluate them once here so the common case (no
+      chroma keying) doesn't pay a function call per overlay pixel.*/
+    int             chroma_active = banshee->chroma_key_enabled && (banshee->vidProcCfg & (1 << 5)) && ((uint32_t) (displine - svga->y_add) <= 2048);
 
     if (svga->render == svga_render_null && !svga->changedvram[src_addr >> 12] && !svga->changedvram[src_addr2 >> 12] && !svga->fullchange && ((voodoo->overlay.src_y >> 20) < 2048 && !voodoo->dirty_line[voodoo->overlay.src_y >> 20]) && !(banshee->vidProcCfg & VIDPROCCFG_V_SCALE_ENABLE)) {
         voodoo->overlay.src_y += (1 << 20);
@@ -2817,7 +2831,7 @@ banshee_overlay_draw(svga_t *svga, int displine)
                         int      r         = (((samp0 >> 16) & 0xff) * coeffs[0] + ((samp1 >> 16) & 0xff) * coeffs[1] + ((samp2 >> 16) & 0xff) * coeffs[2] + ((samp3 >> 16) & 0xff) * coeffs[3]) >> 16;
                         int      g         = (((samp0 >> 8) & 0xff) * coeffs[0] + ((samp1 >> 8) & 0xff) * coeffs[1] + ((samp2 >> 8) & 0xff) * coeffs[2] + ((samp3 >> 8) & 0xff) * coeffs[3]) >> 16;
                         int      b         = ((samp0 & 0xff) * coeffs[0] + (samp1 & 0xff) * coeffs[1] + (samp2 & 0xff) * coeffs[2] + (samp3 & 0xff) * coeffs[3]) >> 16;
-                        chroma_test_passed = banshee_chroma_key(banshee, svga->overlay_latch.x + x, displine - svga->y_add);
+                        chroma_test_passed = !chroma_active || banshee_chroma_key(banshee, svga->overlay_latch.x + x, displine - svga->y_add);
 
                         if (chroma_test_passed)
                             p[x] = (r << 16) | (g << 8) | b;
@@ -2831,7 +2845,7 @@ banshee_overlay_draw(svga_t *svga, int displine)
                         int      r         = (((samp0 >> 16) & 0xff) * (0x10000 - y_coeff) + ((samp1 >> 16) & 0xff) * y_coeff) >> 16;
                         int      g         = (((samp0 >> 8) & 0xff) * (0x10000 - y_coeff) + ((samp1 >> 8) & 0xff) * y_coeff) >> 16;
                         int      b         = ((samp0 & 0xff) * (0x10000 - y_coeff) + (samp1 & 0xff) * y_coeff) >> 16;
-                        chroma_test_passed = banshee_chroma_key(banshee, svga->overlay_latch.x + x, displine - svga->y_add);
+                        chroma_test_passed = !chroma_active || banshee_chroma_key(banshee, svga->overlay_latch.x + x, displine - svga->y_add);
 
                         if (chroma_test_passed)
                             p[x] = (r << 16) | (g << 8) | b;
@@ -2892,7 +2906,7 @@ banshee_overlay_draw(svga_t *svga, int displine)
                         fil[x * 3]         = vb_filter_v1_rb[fil[x * 3]][fil3[(x + 1) * 3]];
                         fil[x * 3 + 1]     = vb_filter_v1_g[fil[x * 3 + 1]][fil3[(x + 1) * 3 + 1]];
                         fil[x * 3 + 2]     = vb_filter_v1_rb[fil[x * 3 + 2]][fil3[(x + 1) * 3 + 2]];
-                        chroma_test_passed = banshee_chroma_key(banshee, svga->overlay_latch.x + x, displine - svga->y_add);
+                        chroma_test_passed = !chroma_active || banshee_chroma_key(banshee, svga->overlay_latch.x + x, displine - svga->y_add);
 
                         if (chroma_test_passed)
                             p[x] = (fil[x * 3 + 2] << 16) | (fil[x * 3 + 1] << 8) | fil[x * 3];
@@ -2901,7 +2915,7 @@ banshee_overlay_draw(svga_t *svga, int displine)
                 {
                     if (banshee->vidProcCfg & VIDPROCCFG_H_SCALE_ENABLE) {
                         for (x = 0; x < svga->overlay_latch.cur_xsize; x++) {
-                            chroma_test_passed = banshee_chroma_key(banshee, svga->overlay_latch.x + x, displine - svga->y_add);
+                            chroma_test_passed = !chroma_active || banshee_chroma_key(banshee, svga->overlay_latch.x + x, displine - svga->y_add);
                             if (chroma_test_passed)
                                 p[x] = banshee->overlay_buffer[0][src_x >> 20];
 
@@ -2909,7 +2923,7 @@ banshee_overlay_draw(svga_t *svga, int displine)
                         }
                     } else {
                         for (x = 0; x < svga->overlay_latch.cur_xsize; x++) {
-                            chroma_test_passed = banshee_chroma_key(banshee, svga->overlay_latch.x + x, displine - svga->y_add);
+                            chroma_test_passed = !chroma_active || banshee_chroma_key(banshee, svga->overlay_latch.x + x, displine - svga->y_add);
                             if (chroma_test_passed)
                                 p[x] = banshee->overlay_buffer[0][x];
                         }
@@ -2967,7 +2981,7 @@ banshee_overlay_draw(svga_t *svga, int displine)
                     if (banshee->vidProcCfg & VIDPROCCFG_H_SCALE_ENABLE) /* 2x2 on a scaled low res */
                     {
                         for (x = 0; x < svga->overlay_latch.cur_xsize; x++) {
-                            chroma_test_passed = banshee_chroma_key(banshee, svga->overlay_latch.x + x, displine - svga->y_add);
+                            chroma_test_passed = !chroma_active || banshee_chroma_key(banshee, svga->overlay_latch.x + x, displine - svga->y_add);
                             if (chroma_test_passed)
                                 p[x] = (fil[(src_x >> 20) * 3 + 2] << 16) | (fil[(src_x >> 20) * 3 + 1] << 8) | fil[(src_x >> 20) * 3];
 
@@ -2975,7 +2989,7 @@ banshee_overlay_draw(svga_t *svga, int displine)
                         }
                     } else {
                         for (x = 0; x < svga->overlay_latch.cur_xsize; x++) {
-                            chroma_test_passed = banshee_chroma_key(banshee, svga->overlay_latch.x + x, displine - svga->y_add);
+                            chroma_test_passed = !chroma_active || banshee_chroma_key(banshee, svga->overlay_latch.x + x, displine - svga->y_add);
                             if (chroma_test_passed)
                                 p[x] = (fil[x * 3 + 2] << 16) | (fil[x * 3 + 1] << 8) | fil[x * 3];
                         }
@@ -2984,7 +2998,7 @@ banshee_overlay_draw(svga_t *svga, int displine)
                 {
                     if (banshee->vidProcCfg & VIDPROCCFG_H_SCALE_ENABLE) {
                         for (x = 0; x < svga->overlay_latch.cur_xsize; x++) {
-                            chroma_test_passed = banshee_chroma_key(banshee, svga->overlay_latch.x + x, displine - svga->y_add);
+                            chroma_test_passed = !chroma_active || banshee_chroma_key(banshee, svga->overlay_latch.x + x, displine - svga->y_add);
                             if (chroma_test_passed)
                                 p[x] = banshee->overlay_buffer[0][src_x >> 20];
 
@@ -2992,7 +3006,7 @@ banshee_overlay_draw(svga_t *svga, int displine)
                         }
                     } else {
                         for (x = 0; x < svga->overlay_latch.cur_xsize; x++) {
-                            chroma_test_passed = banshee_chroma_key(banshee, svga->overlay_latch.x + x, displine - svga->y_add);
+                            chroma_test_passed = !chroma_active || banshee_chroma_key(banshee, svga->overlay_latch.x + x, displine - svga->y_add);
                             if (chroma_test_passed)
                                 p[x] = banshee->overlay_buffer[0][x];
                         }
@@ -3004,7 +3018,7 @@ banshee_overlay_draw(svga_t *svga, int displine)
             default:
                 if (banshee->vidProcCfg & VIDPROCCFG_H_SCALE_ENABLE) {
                     for (x = 0; x < svga->overlay_latch.cur_xsize; x++) {
-                        chroma_test_passed = banshee_chroma_key(banshee, svga->overlay_latch.x + x, displine - svga->y_add);
+                        chroma_test_passed = !chroma_active || banshee_chroma_key(banshee, svga->overlay_latch.x + x, displine - svga->y_add);
                         if (chroma_test_passed)
                             p[x] = banshee->overlay_buffer[0][src_x >> 20];
 
@@ -3012,7 +3026,7 @@ banshee_overlay_draw(svga_t *svga, int displine)
                     }
                 } else {
                     for (x = 0; x < svga->overlay_latch.cur_xsize; x++) {
-                        chroma_test_passed = banshee_chroma_key(banshee, svga->overlay_latch.x + x, displine - svga->y_add);
+                        chroma_test_passed = !chroma_active || banshee_chroma_key(banshee, svga->overlay_latch.x + x, displine - svga->y_add);
                         if (chroma_test_passed)
                             p[x] = banshee->overlay_buffer[0][x];
                     }
@@ -3891,6 +3905,7 @@ static const device_config_t banshee_sgram_config[] = {
             { .description = "1", .value = 1 },
             { .description = "2", .value = 2 },
             { .description = "4", .value = 4 },
+            { .description = "8", .value = 8 },
             { .description = ""              }
         },
         .bios           = { { 0 } }
@@ -3968,6 +3983,7 @@ static const device_config_t banshee_sgram_16mbonly_config[] = {
             { .description = "1", .value = 1 },
             { .description = "2", .value = 2 },
             { .description = "4", .value = 4 },
+            { .description = "8", .value = 8 },
             { .description = ""              }
         },
         .bios           = { { 0 } }
@@ -4045,6 +4061,7 @@ static const device_config_t banshee_sdram_config[] = {
             { .description = "1", .value = 1 },
             { .description = "2", .value = 2 },
             { .description = "4", .value = 4 },
+            { .description = "8", .value = 8 },
             { .description = ""              }
         },
         .bios           = { { 0 } }
@@ -589,6 +589,68 @@ do_screen_to_screen_line(voodoo_t *voodoo, uint8_t *src_p, int use_x_dir, int sr
 #endif
     if ((voodoo->banshee_blt.srcFormat & SRC_FORMAT_COL_MASK) == (voodoo->banshee_blt.dstFormat & DST_FORMAT_COL_MASK)) {
         /*No conversion required*/
+
+        /*
+           Row fast path for the most common case by far: SRCCOPY with no
+           colorkeying, no pattern transparency, linear (untiled) surfaces
+           and a left-to-right copy. The whole clipped span is one memcpy;
+           anything else falls through to the per-pixel loop.
+         */
+        if ((dst_y >= clip->y_min) && (dst_y < clip->y_max)
+            && (voodoo->banshee_blt.rops[0] == 0xcc)
+            && !(voodoo->banshee_blt.commandExtra & (CMDEXTRA_SRC_COLORKEY | CMDEXTRA_DST_COLORKEY))
+            && !use_pattern_trans && !src_tiled && !voodoo->banshee_blt.dstBaseAddr_tiled
+            && (!use_x_dir || !(voodoo->banshee_blt.command & COMMAND_DX))) {
+            int bypp = 0;
+
+            switch (voodoo->banshee_blt.dstFormat & DST_FORMAT_COL_MASK) {
+                case DST_FORMAT_COL_8_BPP:
+                    bypp = 1;
+                    break;
+                case DST_FORMAT_COL_16_BPP:
+                    bypp = 2;
+                    break;
+                case DST_FORMAT_COL_32_BPP:
+                    bypp = 4;
+                    break;
+                default: /*24 bpp preserves the destination alpha byte - keep it per-pixel*/
+                    break;
+            }
+
+            if (bypp) {
+                int x0   = voodoo->banshee_blt.dstX;
+                int x1   = x0 + voodoo->banshee_blt.dstSizeX;
+                int skip = 0;
+
+                if (x0 < clip->x_min) {
+                    skip = clip->x_min - x0;
+                    x0   = clip->x_min;
+                }
+                if (x1 > clip->x_max)
+                    x1 = clip->x_max;
+
+                if (x1 > x0) {
+                    uint32_t       len       = (x1 - x0) * bypp;
+                    uint32_t       dst_start = (voodoo->banshee_blt.dstBaseAddr + (x0 * bypp) + (dst_y * voodoo->banshee_blt.dst_stride)) & voodoo->fb_mask;
+                    const uint8_t *src_start = src_p + (((src_x + skip) * voodoo->banshee_blt.src_bpp) >> 3);
+                    uintptr_t      src_lo    = (uintptr_t) src_start;
+                    uintptr_t      dst_lo    = (uintptr_t) &voodoo->vram[dst_start];
+
+                    /* Punt on rows that wrap the framebuffer mask or overlap in memory. */
+                    if (((dst_start + len - 1) <= voodoo->fb_mask)
+                        && (((src_lo + len) <= dst_lo) || (src_lo >= (dst_lo + len)))) {
+                        memcpy(&voodoo->vram[dst_start], src_start, len);
+                        for (uint32_t page = dst_start >> 12; page <= ((dst_start + len - 1) >> 12); page++)
+                            voodoo->changedvram[page] = changeframecount;
+                        voodoo->banshee_blt.cur_x = voodoo->banshee_blt.dstSizeX;
+                        voodoo->banshee_blt.srcY += (voodoo->banshee_blt.command & COMMAND_DY) ? -1 : 1;
+                        voodoo->banshee_blt.dstY += (voodoo->banshee_blt.command & COMMAND_DY) ? -1 : 1;
+                        return;
+                    }
+                }
+            }
+        }
+
         if (dst_y >= clip->y_min && dst_y < clip->y_max) {
             int     dst_x        = voodoo->banshee_blt.dstX;
             int     pat_x        = voodoo->banshee_blt.patoff_x + voodoo->banshee_blt.dstX;
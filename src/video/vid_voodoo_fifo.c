@@ -30,6 +30,7 @@
 #include <86box/device.h>
 #include <86box/plat.h>
 #include <86box/thread.h>
+#include <minitrace/minitrace.h>
 #include <86box/video.h>
 #include <86box/vid_svga.h>
 #include <86box/vid_voodoo_common.h>
@@ -209,15 +210,12 @@ voodoo_queue_command(voodoo_t *voodoo, uint32_t addr_type, uint32_t val)
         voodoo->fifo_full_spin_checks += fifo_wait_spins;
     }
 
-#ifdef _WIN32
-    /* Reset only after an empty signal to avoid heavy ResetEvent churn on Windows. */
+    /* Reset only after an empty signal so back-to-back commands don't pay an
+       event reset each; the FIFO thread re-signals when it drains. */
     if (ATOMIC_LOAD(voodoo->fifo_empty_signaled)) {
         ATOMIC_STORE(voodoo->fifo_empty_signaled, 0);
         thread_reset_event(voodoo->fifo_empty_event);
     }
-#else
-    thread_reset_event(voodoo->fifo_empty_event);
-#endif
 
     fifo->val        = val;
     fifo->addr_type  = addr_type;
@@ -291,6 +289,35 @@ voodoo_wait_for_swap_complete(voodoo_t *voodoo)
     }
 }
 
+/* Fetch one dword of AGP command stream through a small prefetch buffer.
+   mem_readl_phys() resolves the bus mapping on every call, which adds up
+   when the FIFO thread is pulling a long command stream out of system RAM;
+   batching the DMA fetch with mem_read_phys_bulk() amortises that lookup
+   across up to CMDFIFO_PREFETCH dwords. Outside of subroutines the fetch
+   never runs ahead of the committed FIFO depth; the buffer is addressed by
+   guest physical address and is explicitly dropped whenever the read
+   pointer moves non-sequentially (JSR/RET/JMP packets, host writes to
+   cmdFifoRdPtr), so a refetch at the same address after a ring wrap can
+   never be served stale data. */
+#define CMDFIFO_PREFETCH 16
+
+static uint32_t
+cmdfifo_agp_readl(uint32_t addr, int max_dwords, uint32_t *buf,
+                  uint32_t *buf_addr, int *buf_pos, int *buf_len)
+{
+    if ((*buf_pos >= *buf_len) || ((*buf_addr + ((uint32_t) *buf_pos << 2)) != addr)) {
+        if (max_dwords < 1)
+            max_dwords = 1;
+        else if (max_dwords > CMDFIFO_PREFETCH)
+            max_dwords = CMDFIFO_PREFETCH;
+        mem_read_phys_bulk(buf, addr, (uint32_t) max_dwords << 2, 4);
+        *buf_addr = addr;
+        *buf_pos  = 0;
+        *buf_len  = max_dwords;
+    }
+    return buf[(*buf_pos)++];
+}
+
 static uint32_t
 cmdfifo_get(voodoo_t *voodoo)
 {
@@ -304,7 +331,10 @@ cmdfifo_get(voodoo_t *voodoo)
     }
 
     if (voodoo->cmdfifo_in_agp)
-        val = mem_readl_phys(voodoo->cmdfifo_rp);
+        val = cmdfifo_agp_readl(voodoo->cmdfifo_rp,
+                                voodoo->cmdfifo_in_sub ? CMDFIFO_PREFETCH : (voodoo->cmdfifo_depth_wr - voodoo->cmdfifo_depth_rd),
+                                voodoo->cmdfifo_prefetch, &voodoo->cmdfifo_prefetch_addr,
+                                &voodoo->cmdfifo_prefetch_pos, &voodoo->cmdfifo_prefetch_len);
     else
         val = *(uint32_t *) &voodoo->fb_mem[voodoo->cmdfifo_rp & voodoo->fb_mask];
 
@@ -341,7 +371,10 @@ cmdfifo_get_2(voodoo_t *voodoo)
     }
 
     if (voodoo->cmdfifo_in_agp_2)
-        val = mem_readl_phys(voodoo->cmdfifo_rp_2);
+        val = cmdfifo_agp_readl(voodoo->cmdfifo_rp_2,
+                                voodoo->cmdfifo_in_sub_2 ? CMDFIFO_PREFETCH : (voodoo->cmdfifo_depth_wr_2 - voodoo->cmdfifo_depth_rd_2),
+                                voodoo->cmdfifo_prefetch_2, &voodoo->cmdfifo_prefetch_addr_2,
+                                &voodoo->cmdfifo_prefetch_pos_2, &voodoo->cmdfifo_prefetch_len_2);
     else
         val = *(uint32_t *) &voodoo->fb_mem[voodoo->cmdfifo_rp_2 & voodoo->fb_mask];
 
@@ -388,10 +421,15 @@ voodoo_fifo_thread(void *param)
         thread_wait_event(voodoo->wake_fifo_thread, -1);
         thread_reset_event(voodoo->wake_fifo_thread);
         voodoo->voodoo_busy = 1;
+        MTR_COUNTER("voodoo", "fifo_depth", FIFO_ENTRIES);
         while (!FIFO_EMPTY) {
             uint64_t      start_time = plat_timer_read();
             uint64_t      end_time;
             fifo_entry_t *fifo = &voodoo->fifo[voodoo->fifo_read_idx & FIFO_MASK];
+            /*Sample the write index once per batch; commands queued mid-batch
+              are picked up by the outer loop without re-reading the shared
+              index on every entry.*/
+            uint32_t      end_idx = voodoo->fifo_write_idx;
 
             switch (fifo->addr_type & FIFO_TYPE) {
                 case FIFO_WRITEL_REG:
@@ -405,7 +443,7 @@ voodoo_fifo_thread(void *param)
                         if (target_buf < VOODOO_BUF_COUNT) {
                             ATOMIC_DEC(voodoo->pending_draw_cmds_buf[target_buf]);
                         }
-                        if (FIFO_EMPTY)
+                        if (voodoo->fifo_read_idx == end_idx)
                             break;
                         fifo = &voodoo->fifo[voodoo->fifo_read_idx & FIFO_MASK];
                     }
@@ -421,7 +459,7 @@ voodoo_fifo_thread(void *param)
                         if (target_buf < VOODOO_BUF_COUNT) {
                             ATOMIC_DEC(voodoo->pending_fb_writes_buf[target_buf]);
                         }
-                        if (FIFO_EMPTY)
+                        if (voodoo->fifo_read_idx == end_idx)
                             break;
                         fifo = &voodoo->fifo[voodoo->fifo_read_idx & FIFO_MASK];
                     }
@@ -437,7 +475,7 @@ voodoo_fifo_thread(void *param)
                         if (target_buf < VOODOO_BUF_COUNT) {
                             ATOMIC_DEC(voodoo->pending_fb_writes_buf[target_buf]);
                         }
-                        if (FIFO_EMPTY)
+                        if (voodoo->fifo_read_idx == end_idx)
                             break;
                         fifo = &voodoo->fifo[voodoo->fifo_read_idx & FIFO_MASK];
                     }
@@ -448,7 +486,7 @@ voodoo_fifo_thread(void *param)
                             voodoo_tex_writel(fifo->addr_type & FIFO_ADDR, fifo->val, voodoo);
                         fifo->addr_type = FIFO_INVALID;
                         voodoo->fifo_read_idx++;
-                        if (FIFO_EMPTY)
+                        if (voodoo->fifo_read_idx == end_idx)
                             break;
                         fifo = &voodoo->fifo[voodoo->fifo_read_idx & FIFO_MASK];
                     }
@@ -458,7 +496,7 @@ voodoo_fifo_thread(void *param)
                         voodoo_2d_reg_writel(voodoo, fifo->addr_type & FIFO_ADDR, fifo->val);
                         fifo->addr_type = FIFO_INVALID;
                         voodoo->fifo_read_idx++;
-                        if (FIFO_EMPTY)
+                        if (voodoo->fifo_read_idx == end_idx)
                             break;
                         fifo = &voodoo->fifo[voodoo->fifo_read_idx & FIFO_MASK];
                     }
@@ -475,6 +513,8 @@ voodoo_fifo_thread(void *param)
             voodoo->time += end_time - start_time;
         }
 
+        MTR_COUNTER("voodoo", "fifo_depth", 0);
+
         voodoo->cmd_status |= (1 << 24);
         voodoo->cmd_status_2 |= (1 << 24);
         thread_set_event(voodoo->fifo_empty_event);
@@ -512,19 +552,22 @@ voodoo_fifo_thread(void *param)
 #if 0
                             voodoo_fifo_log("JSR %08x\n", (header >> 4) & 0xfffffc);
 #endif
-                            voodoo->cmdfifo_ret_addr = voodoo->cmdfifo_rp;
-                            voodoo->cmdfifo_rp       = (header >> 4) & 0xfffffc;
-                            voodoo->cmdfifo_in_sub   = 1;
+                            voodoo->cmdfifo_ret_addr     = voodoo->cmdfifo_rp;
+                            voodoo->cmdfifo_rp           = (header >> 4) & 0xfffffc;
+                            voodoo->cmdfifo_in_sub       = 1;
+                            voodoo->cmdfifo_prefetch_len = 0;
                             break;
 
                         case 2: /*RET*/
-                            voodoo->cmdfifo_rp     = voodoo->cmdfifo_ret_addr;
-                            voodoo->cmdfifo_in_sub = 0;
+                            voodoo->cmdfifo_rp           = voodoo->cmdfifo_ret_addr;
+                            voodoo->cmdfifo_in_sub       = 0;
+                            voodoo->cmdfifo_prefetch_len = 0;
                             break;
 
                         case 3: /*JMP local frame buffer*/
-                            voodoo->cmdfifo_rp     = (header >> 4) & 0xfffffc;
-                            voodoo->cmdfifo_in_agp = 0;
+                            voodoo->cmdfifo_rp           = (header >> 4) & 0xfffffc;
+                            voodoo->cmdfifo_in_agp       = 0;
+                            voodoo->cmdfifo_prefetch_len = 0;
 #if 0
                             voodoo_fifo_log("JMP LFB to %08x %04x\n", voodoo->cmdfifo_rp, header);
 #endif
@@ -534,8 +577,9 @@ voodoo_fifo_thread(void *param)
                             if (UNLIKELY(voodoo->type < VOODOO_BANSHEE))
                                 fatal("CMDFIFO0: Not Banshee %08x\n", header);
 
-                            voodoo->cmdfifo_rp     = ((header >> 4) & 0x1fffffc) | (cmdfifo_get(voodoo) << 25);
-                            voodoo->cmdfifo_in_agp = 1;
+                            voodoo->cmdfifo_rp           = ((header >> 4) & 0x1fffffc) | (cmdfifo_get(voodoo) << 25);
+                            voodoo->cmdfifo_in_agp       = 1;
+                            voodoo->cmdfifo_prefetch_len = 0;
 #if 0
                             voodoo_fifo_log("JMP AGP to %08x %04x\n", voodoo->cmdfifo_rp, header);
 #endif
@@ -803,19 +847,22 @@ voodoo_fifo_thread(void *param)
 #if 0
                             voodoo_fifo_log("JSR %08x\n", (header >> 4) & 0xfffffc);
 #endif
-                            voodoo->cmdfifo_ret_addr_2 = voodoo->cmdfifo_rp_2;
-                            voodoo->cmdfifo_rp_2       = (header >> 4) & 0xfffffc;
-                            voodoo->cmdfifo_in_sub_2   = 1;
+                            voodoo->cmdfifo_ret_addr_2     = voodoo->cmdfifo_rp_2;
+                            voodoo->cmdfifo_rp_2           = (header >> 4) & 0xfffffc;
+                            voodoo->cmdfifo_in_sub_2       = 1;
+                            voodoo->cmdfifo_prefetch_len_2 = 0;
                             break;
 
                         case 2: /*RET*/
-                            voodoo->cmdfifo_rp_2     = voodoo->cmdfifo_ret_addr_2;
-                            voodoo->cmdfifo_in_sub_2 = 0;
+                            voodoo->cmdfifo_rp_2           = voodoo->cmdfifo_ret_addr_2;
+                            voodoo->cmdfifo_in_sub_2       = 0;
+                            voodoo->cmdfifo_prefetch_len_2 = 0;
                             break;
 
                         case 3: /*JMP local frame buffer*/
-                            voodoo->cmdfifo_rp_2     = (header >> 4) & 0xfffffc;
-                            voodoo->cmdfifo_in_agp_2 = 0;
+                            voodoo->cmdfifo_rp_2           = (header >> 4) & 0xfffffc;
+                            voodoo->cmdfifo_in_agp_2       = 0;
+                            voodoo->cmdfifo_prefetch_len_2 = 0;
 #if 0
                             voodoo_fifo_log("JMP LFB to %08x %04x\n", voodoo->cmdfifo_rp_2, header);
 #endif
@@ -825,8 +872,9 @@ voodoo_fifo_thread(void *param)
                             if (UNLIKELY(voodoo->type < VOODOO_BANSHEE))
                                 fatal("CMDFIFO0: Not Banshee %08x\n", header);
 
-                            voodoo->cmdfifo_rp_2     = ((header >> 4) & 0x1fffffc) | (cmdfifo_get_2(voodoo) << 25);
-                            voodoo->cmdfifo_in_agp_2 = 1;
+                            voodoo->cmdfifo_rp_2           = ((header >> 4) & 0x1fffffc) | (cmdfifo_get_2(voodoo) << 25);
+                            voodoo->cmdfifo_in_agp_2       = 1;
+                            voodoo->cmdfifo_prefetch_len_2 = 0;
 #if 0
                             voodoo_fifo_log("JMP AGP to %08x %04x\n", voodoo->cmdfifo_rp_2, header);
 #endif
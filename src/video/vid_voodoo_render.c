@@ -661,6 +661,130 @@ voodoo_tmu_fetch_and_blend(voodoo_t *voodoo, voodoo_params_t *params, voodoo_sta
 int voodoo_recomp = 0;
 #endif
 
+/*Check whether the current render state reduces to a single-TMU decal
+  texture, depth-buffered and depth-written, with no alpha test/blend, fog,
+  chroma-key or stipple. This covers the bulk of opaque world geometry and
+  can be drawn by the specialised span loop below.*/
+static int
+voodoo_fast_span_ok(voodoo_t *voodoo, voodoo_params_t *params)
+{
+    if (params->fbzMode & (FBZ_STIPPLE | FBZ_DEPTH_BIAS | FBZ_DEPTH_SOURCE | FBZ_CHROMAKEY | FBZ_ALPHA_MASK | FBZ_ALPHA_ENABLE))
+        return 0;
+    if ((params->fbzMode & (FBZ_DEPTH_ENABLE | FBZ_RGB_WMASK | FBZ_DEPTH_WMASK)) != (FBZ_DEPTH_ENABLE | FBZ_RGB_WMASK | FBZ_DEPTH_WMASK))
+        return 0;
+    /*Colour path must pass the texel through unmodified*/
+    if (!(params->fbzColorPath & FBZCP_TEXTURE_ENABLED) || _rgb_sel != CC_LOCALSELECT_TEX)
+        return 0;
+    if (cc_zero_other || cc_sub_clocal || cc_mselect != CC_MSELECT_ZERO || cc_reverse_blend || cc_add || cc_invert_output || cc_localselect_override)
+        return 0;
+    if (params->fogMode & FOG_ENABLE)
+        return 0;
+    if (params->alphaMode & ((1 << 0) | (1 << 4))) /*alpha test or blend*/
+        return 0;
+    /*Only TMU0 sampling its local colour*/
+    if (voodoo->dual_tmus && (params->textureMode[0] & TEXTUREMODE_LOCAL_MASK) != TEXTUREMODE_LOCAL)
+        return 0;
+    if (voodoo->trexInit1[0] & (1 << 18))
+        return 0;
+
+    return 1;
+}
+
+/*Span loop specialised for the state checked by voodoo_fast_span_ok().
+  Only the depth, TMU0 and W iterators are stepped and the whole
+  colour/alpha-combine machinery is skipped; output is identical to the
+  general loop for this state.*/
+static void
+voodoo_fast_span(voodoo_t *voodoo, voodoo_params_t *params, voodoo_state_t *state, int x, int x2, int real_y, int odd_even)
+{
+    uint16_t *fb_mem  = state->fb_mem;
+    uint16_t *aux_mem = state->aux_mem;
+    int       start_x;
+
+    do {
+        int     x_tiled = (x & 63) | ((x >> 6) * 128 * 32 / 2);
+        int32_t new_depth;
+
+        start_x  = x;
+        state->x = x;
+        voodoo->pixel_count[odd_even]++;
+        voodoo->texel_count[odd_even]++;
+        voodoo->fbiPixelsIn++;
+
+        if (params->fbzMode & FBZ_W_BUFFER) {
+            if (state->w & 0xffff00000000)
+                new_depth = 0;
+            else if (!(state->w & 0xffff0000))
+                new_depth = 0xf001;
+            else {
+                int exp  = voodoo_fls((uint16_t) ((uint32_t) state->w >> 16));
+                int mant = (~(uint32_t) state->w >> (19 - exp)) & 0xfff;
+
+                new_depth = (exp << 12) + mant + 1;
+                if (new_depth > 0xffff)
+                    new_depth = 0xffff;
+            }
+        } else
+            new_depth = CLAMP16(state->z >> 12);
+
+        {
+            uint16_t old_depth = voodoo->params.aux_tiled ? aux_mem[x_tiled] : aux_mem[x];
+
+            DEPTH_TEST(new_depth);
+        }
+
+        voodoo_tmu_fetch(voodoo, params, state, 0, x);
+
+        {
+            int src_r = state->tex_r[0];
+            int src_g = state->tex_g[0];
+            int src_b = state->tex_b[0];
+
+            if (dither) {
+                if (dither2x2) {
+                    src_r = dither_rb2x2[src_r][real_y & 1][x & 1];
+                    src_g = dither_g2x2[src_g][real_y & 1][x & 1];
+                    src_b = dither_rb2x2[src_b][real_y & 1][x & 1];
+                } else {
+                    src_r = dither_rb[src_r][real_y & 3][x & 3];
+                    src_g = dither_g[src_g][real_y & 3][x & 3];
+                    src_b = dither_rb[src_b][real_y & 3][x & 3];
+                }
+            } else {
+                src_r >>= 3;
+                src_g >>= 2;
+                src_b >>= 3;
+            }
+
+            if (voodoo->params.col_tiled)
+                fb_mem[x_tiled] = src_b | (src_g << 5) | (src_r << 11);
+            else
+                fb_mem[x] = src_b | (src_g << 5) | (src_r << 11);
+            if (voodoo->params.aux_tiled)
+                aux_mem[x_tiled] = new_depth;
+            else
+                aux_mem[x] = new_depth;
+        }
+        voodoo->fbiPixelsOut++;
+skip_pixel:
+        if (state->xdir > 0) {
+            state->z += params->dZdX;
+            state->tmu0_s += params->tmu[0].dSdX;
+            state->tmu0_t += params->tmu[0].dTdX;
+            state->tmu0_w += params->tmu[0].dWdX;
+            state->w += params->dWdX;
+        } else {
+            state->z -= params->dZdX;
+            state->tmu0_s -= params->tmu[0].dSdX;
+            state->tmu0_t -= params->tmu[0].dTdX;
+            state->tmu0_w -= params->tmu[0].dWdX;
+            state->w -= params->dWdX;
+        }
+
+        x += state->xdir;
+    } while (start_x != x2);
+}
+
 static void
 voodoo_half_triangle(voodoo_t *voodoo, voodoo_params_t *params, voodoo_state_t *state, int ystart, int yend, int odd_even)
 {
@@ -691,6 +815,7 @@ voodoo_half_triangle(voodoo_t *voodoo, voodoo_params_t *params, voodoo_state_t *
     int dither                  = params->fbzMode & FBZ_DITHER;*/
 #endif
     int texels;
+    int use_fast_span;
 #ifndef NO_CODEGEN
     uint8_t (*voodoo_draw)(voodoo_state_t * state, voodoo_params_t * params, int x, int real_y);
 #endif
@@ -787,6 +912,7 @@ voodoo_half_triangle(voodoo_t *voodoo, voodoo_params_t *params, voodoo_state_t *
     else
         voodoo_draw = NULL;
 #endif
+    use_fast_span = voodoo_fast_span_ok(voodoo, params);
 
     voodoo_render_log("dxAB=%08x dxBC=%08x dxAC=%08x\n", state->dxAB, state->dxBC, state->dxAC);
 #if 0
@@ -938,6 +1064,9 @@ voodoo_half_triangle(voodoo_t *voodoo, voodoo_params_t *params, voodoo_state_t *
             voodoo_draw(state, params, x, real_y);
         } else
 #endif
+        if (use_fast_span)
+            voodoo_fast_span(voodoo, params, state, x, x2, real_y, odd_even);
+        else
             do {
                 int x_tiled = (x & 63) | ((x >> 6) * 128 * 32 / 2);
                 start_x     = x;
@@ -1634,28 +1763,62 @@ voodoo_render_thread_4(void *param)
 {
     render_thread(param, 3);
 }
+void
+voodoo_render_thread_5(void *param)
+{
+    render_thread(param, 4);
+}
+void
+voodoo_render_thread_6(void *param)
+{
+    render_thread(param, 5);
+}
+void
+voodoo_render_thread_7(void *param)
+{
+    render_thread(param, 6);
+}
+void
+voodoo_render_thread_8(void *param)
+{
+    render_thread(param, 7);
+}
+
+void (*voodoo_render_thread_funcs[RENDER_THREADS_MAX])(void *param) = {
+    voodoo_render_thread_1,
+    voodoo_render_thread_2,
+    voodoo_render_thread_3,
+    voodoo_render_thread_4,
+    voodoo_render_thread_5,
+    voodoo_render_thread_6,
+    voodoo_render_thread_7,
+    voodoo_render_thread_8
+};
+
+static int
+voodoo_params_full(voodoo_t *voodoo)
+{
+    for (int c = 0; c < voodoo->render_threads; c++) {
+        if (PARAM_FULL(c))
+            return 1;
+    }
+
+    return 0;
+}
 
 void
 voodoo_queue_triangle(voodoo_t *voodoo, voodoo_params_t *params)
 {
     voodoo_params_t *params_new = &voodoo->params_buffer[voodoo->params_write_idx & PARAM_MASK];
-
-    while (PARAM_FULL(0) || (voodoo->render_threads >= 2 && PARAM_FULL(1)) || (voodoo->render_threads == 4 && (PARAM_FULL(2) || PARAM_FULL(3)))) {
-        thread_reset_event(voodoo->render_not_full_event[0]);
-        if (voodoo->render_threads >= 2)
-            thread_reset_event(voodoo->render_not_full_event[1]);
-        if (voodoo->render_threads == 4) {
-            thread_reset_event(voodoo->render_not_full_event[2]);
-            thread_reset_event(voodoo->render_not_full_event[3]);
+    int              c;
+
+    while (voodoo_params_full(voodoo)) {
+        for (c = 0; c < voodoo->render_threads; c++)
+            thread_reset_event(voodoo->render_not_full_event[c]);
+        for (c = 0; c < voodoo->render_threads; c++) {
+            if (PARAM_FULL(c))
+                thread_wait_event(voodoo->render_not_full_event[c], -1); /*Wait for room in ringbuffer*/
         }
-        if (PARAM_FULL(0))
-            thread_wait_event(voodoo->render_not_full_event[0], -1); /*Wait for room in ringbuffer*/
-        if (voodoo->render_threads >= 2 && PARAM_FULL(1))
-            thread_wait_event(voodoo->render_not_full_event[1], -1); /*Wait for room in ringbuffer*/
-        if (voodoo->render_threads == 4 && PARAM_FULL(2))
-            thread_wait_event(voodoo->render_not_full_event[2], -1); /*Wait for room in ringbuffer*/
-        if (voodoo->render_threads == 4 && PARAM_FULL(3))
-            thread_wait_event(voodoo->render_not_full_event[3], -1); /*Wait for room in ringbuffer*/
     }
 
     voodoo_use_texture(voodoo, params, 0);
@@ -1666,6 +1829,10 @@ voodoo_queue_triangle(voodoo_t *voodoo, voodoo_params_t *params)
 
     voodoo->params_write_idx++;
 
-    if (PARAM_ENTRIES(0) < 4 || (voodoo->render_threads >= 2 && PARAM_ENTRIES(1) < 4) || (voodoo->render_threads == 4 && (PARAM_ENTRIES(2) < 4 || PARAM_ENTRIES(3) < 4)))
-        voodoo_wake_render_thread(voodoo);
+    for (c = 0; c < voodoo->render_threads; c++) {
+        if (PARAM_ENTRIES(c) < 4) {
+            voodoo_wake_render_thread(voodoo);
+            break;
+        }
+    }
 }
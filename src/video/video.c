@@ -205,15 +205,21 @@ typedef struct blit_data_struct {
     int x, y, w, h;
     int busy;
     int buffer_in_use;
-    int thread_run;
     int monitor_index;
 
-    thread_t *blit_thread;
-    event_t  *wake_blit_thread;
-    event_t  *blit_complete;
-    event_t  *buffer_not_in_use;
+    event_t *blit_complete;
+    event_t *buffer_not_in_use;
 } blit_data_t;
 
+/* One dispatcher thread multiplexes the blits of all monitors, so a frame
+   costs a single wake/wait pair regardless of how many heads are active.
+   At most one blit per monitor can be pending (the producer waits for the
+   previous one), so a flat scan over monitors[] is the whole work queue. */
+static thread_t *blit_dispatch_thread;
+static event_t  *blit_dispatch_wake;
+static int       blit_dispatch_run;
+static int       blit_dispatch_monitors;
+
 static uint32_t cga_2_table[16];
 
 static void (*blit_func)(int x, int y, int w, int h, int monitor_index);
@@ -385,6 +391,36 @@ video_screenshot(uint32_t *buf, int start_x, int start_y, int row_len)
     video_screenshot_monitor(buf, start_x, start_y, row_len, 0);
 }
 
+/* Final pixel for each gray level with the shade table (or plain
+   replication) and display inversion already folded in, so the copy
+   loops below only do the weighted sum per pixel. */
+static uint32_t video_gray_lut[256];
+static int      video_gray_lut_key = -1;
+
+static void
+video_gray_lut_rebuild(int key)
+{
+    for (uint32_t c = 0; c < 256; c++) {
+        uint32_t color;
+
+        switch (video_grayscale) {
+            case 2:
+            case 3:
+            case 4:
+                color = shade[video_grayscale][c];
+                break;
+            default:
+                color = 0xff000000 | (c * 0x010101);
+                break;
+        }
+        if (invert_display)
+            color ^= 0x00ffffff;
+        video_gray_lut[c] = color;
+    }
+
+    video_gray_lut_key = key;
+}
+
 #ifdef _WIN32
 void *__cdecl video_transform_copy(void *_Dst, const void *_Src, size_t _Size)
 #else
@@ -394,14 +430,38 @@ video_transform_copy(void *__restrict _Dst, const void *__restrict _Src, size_t
 {
     uint32_t       *dest_ex = (uint32_t *) _Dst;
     const uint32_t *src_ex  = (const uint32_t *) _Src;
+    const int       key     = video_grayscale | (video_graytype << 3) | (!!invert_display << 5);
 
     _Size /= sizeof(uint32_t);
 
-    if ((dest_ex != NULL) && (src_ex != NULL)) {
+    if ((dest_ex == NULL) || (src_ex == NULL))
+        return _Dst;
+
+    if (key != video_gray_lut_key)
+        video_gray_lut_rebuild(key);
+
+    if (!video_grayscale) {
+        /* This pointer is only installed when a transform is active, so
+           no grayscale means invert only. */
+        for (size_t i = 0; i < _Size; i++)
+            dest_ex[i] = src_ex[i] ^ 0x00ffffff;
+    } else if (video_graytype == 1) {
         for (size_t i = 0; i < _Size; i++) {
-            *dest_ex = video_color_transform(*src_ex);
-            dest_ex++;
-            src_ex++;
+            const uint32_t c = src_ex[i];
+
+            dest_ex[i] = video_gray_lut[((54 * ((c >> 16) & 0xff)) + (183 * ((c >> 8) & 0xff)) + (18 * (c & 0xff))) / 255];
+        }
+    } else if (video_graytype) {
+        for (size_t i = 0; i < _Size; i++) {
+            const uint32_t c = src_ex[i];
+
+            dest_ex[i] = video_gray_lut[(((c >> 16) & 0xff) + ((c >> 8) & 0xff) + (c & 0xff)) / 3];
+        }
+    } else {
+        for (size_t i = 0; i < _Size; i++) {
+            const uint32_t c = src_ex[i];
+
+            dest_ex[i] = video_gray_lut[((76 * ((c >> 16) & 0xff)) + (150 * ((c >> 8) & 0xff)) + (29 * (c & 0xff))) / 255];
         }
     }
 
@@ -409,24 +469,56 @@ video_transform_copy(void *__restrict _Dst, const void *__restrict _Src, size_t
 }
 
 static void
-blit_thread(void *param)
+blit_thread(UNUSED(void *param))
 {
-    blit_data_t *data = param;
-    while (data->thread_run) {
-        thread_wait_event(data->wake_blit_thread, -1);
-        thread_reset_event(data->wake_blit_thread);
+    while (1) {
+        thread_wait_event(blit_dispatch_wake, -1);
+        thread_reset_event(blit_dispatch_wake);
         MTR_BEGIN("video", "blit_thread");
 
-        if (blit_func)
-            blit_func(data->x, data->y, data->w, data->h, data->monitor_index);
+        /* Always drain pending blits, even when shutting down, so no
+           producer is left waiting on a blit_complete that never comes. */
+        for (int i = 0; i < MONITORS_NUM; i++) {
+            blit_data_t *data = monitors[i].mon_blit_data_ptr;
 
-        data->busy = 0;
+            if (!data || !data->busy)
+                continue;
+
+            if (blit_func)
+                blit_func(data->x, data->y, data->w, data->h, data->monitor_index);
+
+            data->busy = 0;
+            thread_set_event(data->blit_complete);
+        }
 
         MTR_END("video", "blit_thread");
-        thread_set_event(data->blit_complete);
+
+        if (!blit_dispatch_run)
+            break;
     }
 }
 
+static void
+blit_dispatch_start(void)
+{
+    blit_dispatch_wake   = thread_create_event();
+    blit_dispatch_run    = 1;
+    blit_dispatch_thread = thread_create(blit_thread, NULL);
+    /* Pick up any blit left pending while the dispatcher was down. */
+    thread_set_event(blit_dispatch_wake);
+}
+
+static void
+blit_dispatch_stop(void)
+{
+    blit_dispatch_run = 0;
+    thread_set_event(blit_dispatch_wake);
+    thread_wait(blit_dispatch_thread);
+    thread_destroy_event(blit_dispatch_wake);
+    blit_dispatch_thread = NULL;
+    blit_dispatch_wake   = NULL;
+}
+
 void
 video_blit_memtoscreen_monitor(int x, int y, int w, int h, int monitor_index)
 {
@@ -437,15 +529,17 @@ video_blit_memtoscreen_monitor(int x, int y, int w, int h, int monitor_index)
 
     video_wait_for_blit_monitor(monitor_index);
 
-    monitors[monitor_index].mon_blit_data_ptr->busy          = 1;
+    /* The dispatcher scans for busy monitors, so the parameters must be
+       in place before busy is raised. */
     monitors[monitor_index].mon_blit_data_ptr->buffer_in_use = 1;
     monitors[monitor_index].mon_blit_data_ptr->x             = x;
     monitors[monitor_index].mon_blit_data_ptr->y             = y;
     monitors[monitor_index].mon_blit_data_ptr->w             = w;
     monitors[monitor_index].mon_blit_data_ptr->h             = h;
     monitors[monitor_index].mon_renderedframes++;
+    monitors[monitor_index].mon_blit_data_ptr->busy          = 1;
 
-    thread_set_event(monitors[monitor_index].mon_blit_data_ptr->wake_blit_thread);
+    thread_set_event(blit_dispatch_wake);
     MTR_END("video", "video_blit_memtoscreen");
 }
 
@@ -803,10 +897,8 @@ video_monitor_init(int index)
     monitors[index].mon_changeframecount                 = 2;
     monitors[index].target_buffer                        = create_bitmap(2048, 2048);
     monitors[index].mon_blit_data_ptr                    = calloc(1, sizeof(blit_data_t));
-    monitors[index].mon_blit_data_ptr->wake_blit_thread  = thread_create_event();
     monitors[index].mon_blit_data_ptr->blit_complete     = thread_create_event();
     monitors[index].mon_blit_data_ptr->buffer_not_in_use = thread_create_event();
-    monitors[index].mon_blit_data_ptr->thread_run        = 1;
     monitors[index].mon_blit_data_ptr->monitor_index     = index;
     monitors[index].mon_pal_lookup                       = calloc(sizeof(uint32_t), 256);
     monitors[index].mon_cga_palette                      = calloc(1, sizeof(int));
@@ -819,7 +911,8 @@ video_monitor_init(int index)
     atomic_init(&monitors[index].mon_screenshots_raw_clipboard, 0);
     if (index >= 1)
         ui_init_monitor(index);
-    monitors[index].mon_blit_data_ptr->blit_thread = thread_create(blit_thread, monitors[index].mon_blit_data_ptr);
+    if (blit_dispatch_monitors++ == 0)
+        blit_dispatch_start();
 }
 
 void
@@ -828,14 +921,13 @@ video_monitor_close(int monitor_index)
     if (monitors[monitor_index].target_buffer == NULL) {
         return;
     }
-    monitors[monitor_index].mon_blit_data_ptr->thread_run = 0;
-    thread_set_event(monitors[monitor_index].mon_blit_data_ptr->wake_blit_thread);
-    thread_wait(monitors[monitor_index].mon_blit_data_ptr->blit_thread);
+    /* Stop the dispatcher so it cannot touch this monitor's blit data
+       while it is being torn down; restart it for any remaining heads. */
+    blit_dispatch_stop();
     if (monitor_index >= 1)
         ui_deinit_monitor(monitor_index);
     thread_destroy_event(monitors[monitor_index].mon_blit_data_ptr->buffer_not_in_use);
     thread_destroy_event(monitors[monitor_index].mon_blit_data_ptr->blit_complete);
-    thread_destroy_event(monitors[monitor_index].mon_blit_data_ptr->wake_blit_thread);
     free(monitors[monitor_index].mon_blit_data_ptr);
     if (!monitors[monitor_index].mon_pal_lookup_static)
         free(monitors[monitor_index].mon_pal_lookup);
@@ -844,6 +936,8 @@ video_monitor_close(int monitor_index)
     destroy_bitmap(monitors[monitor_index].target_buffer);
     monitors[monitor_index].target_buffer = NULL;
     memset(&monitors[monitor_index], 0, sizeof(monitor_t));
+    if (--blit_dispatch_monitors > 0)
+        blit_dispatch_start();
 }
 
 void